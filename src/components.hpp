@@ -11,8 +11,8 @@ struct EnemyComponent {
 	float damage {1.0f};
 	float attack_timer {0.0f};
 	float attack_cooldown {1.0f};
-	olc::vf2d velocity {0.0f, 0.0f};
 };
+static_assert(sizeof(EnemyComponent) <= 16, "EnemyComponent is walked every tick by the attack and movement systems");
 
 struct PlayerComponent {
 	float health {10.0f};
@@ -40,6 +40,39 @@ struct BulletComponent {
     std::function<void(entt::registry&, entt::dispatcher&, olc::vf2d)> on_kill_func {[](entt::registry&, entt::dispatcher&, olc::vf2d){}};
 };
 
+// What a collider is.  Which layers touch each other is decided by the CollisionSystem.
+// Contacts list the entity on the lower layer first
+enum class CollisionLayer : uint8_t {
+	Bullet,
+	Player,
+	Enemy,
+	Experience,
+	Hazard,
+	Count
+};
+
+struct ColliderComponent {
+	CollisionLayer layer {CollisionLayer::Enemy};
+	// Test the whole path since the last collision pass, for fast movers
+	bool swept {false};
+	// Position at the last collision pass
+	olc::vf2d previous_position {};
+};
+
+struct Bolt;
+
+// Collide with the segments of a bolt instead of a Shape or Projectile.  Only tested against shapes, and kept
+// out of the broadphase since it would overlap most of the screen.  The bolt must outlive the collider
+struct SegmentCollider {
+	const Bolt* bolt {nullptr};
+};
+
+// Fill colour of a Shape or Projectile.  Kept out of them since only drawing reads it, while the physics,
+// transform and collision passes stream the shapes every tick
+struct ColorComponent {
+	olc::Pixel color {olc::MAGENTA};
+};
+
 struct PhysicsComponent {
 	olc::vf2d velocity {};
 	olc::vf2d acceleration {};
@@ -47,7 +80,11 @@ struct PhysicsComponent {
 	float mass {1.0f};
 	float friction {0.95f};
 	float angular_velocity {0.0f};
+	// {sin, cos} of the turn over one physics step, and the angular velocity it was computed for
+	olc::vf2d angular_step {0.0f, 1.0f};
+	float angular_step_velocity {0.0f};
 };
+static_assert(sizeof(PhysicsComponent) <= 48, "PhysicsComponent is streamed every physics step");
 
 struct ParticleComponent {
 	// How long in seconds that particle should stay around
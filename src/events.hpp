@@ -49,6 +49,8 @@ struct SpawnBullet {
 	// bullet shape
 	ShapePrototypes shape;
     olc::Pixel color;
+	// Spawn a Projectile instead of a full Shape
+	bool lightweight {false};
 
 	// Functor called whgen an enemy is hit
 	std::function<void(entt::registry&, entt::dispatcher&, olc::vf2d)> on_hit_func {[](entt::registry&, entt::dispatcher&, olc::vf2d){}};
@@ -57,6 +59,22 @@ struct SpawnBullet {
 
 };
 
+// Area of effect damage to every enemy within radius of position
+struct Explosion {
+	olc::vf2d position;
+	float radius {64.0f};
+	float damage {10.0f};
+	// Cosmetic particles thrown out, they don't collide
+	int particle_count {8};
+	olc::Pixel color {olc::RED};
+
+	// Optionally also fire the old shrapnel bullets in random directions.  Leave shrapnel_count at 0 to only deal the area damage
+	int shrapnel_count {0};
+	float shrapnel_speed {200.0f};
+	// Every shrapnel bullet is a copy of this, with the position and velocity filled in
+	SpawnBullet shrapnel {};
+};
+
 struct SpawnExperience {
 	// Where the experience spawns
 	olc::vf2d position;
@@ -18,6 +18,11 @@
 
 #include "systems/system.hpp"
 #include "systems/physics.hpp"
+#include "systems/spatial_index.hpp"
+#include "systems/spatial_query.hpp"
+#include "systems/collision.hpp"
+#include "systems/transform.hpp"
+#include "systems/morton_sort.hpp"
 #include "systems/enemy_movement.hpp"
 #include "systems/enemy_attack.hpp"
 #include "systems/particle.hpp"
@@ -47,8 +52,6 @@ using namespace entt::literals;
 // Players start as a triangle with 3 weapon slots and gain one slot per progression until 9
 std::array<ShapePrototypes, 7> shape_progression {ShapePrototypes::Triangle, ShapePrototypes::Square, ShapePrototypes::Pentagon, ShapePrototypes::Star6_2, ShapePrototypes::Star7_3, ShapePrototypes::Star8_2, ShapePrototypes::Star9_3};
 
-// Map of the potential prototypes
-std::map<ShapePrototypes, Prototype> prototypes;
 
 std::mt19937_64 rng;
 
@@ -82,6 +85,8 @@ struct GameplayState : public State {
 	float dead_time {0.0f};
 	int boss_kill_count {0};
 
+	const float physics_step;
+
 	// Dispatcher must be first so that it will be destroyed after the registry
 	entt::dispatcher dispatcher;
 	entt::registry reg;
@@ -89,6 +94,10 @@ struct GameplayState : public State {
 	struct enemy_death{};
 
 	std::unique_ptr<System> physics_system;
+	std::unique_ptr<System> spatial_index_system;
+	std::unique_ptr<System> transform_system;
+	std::unique_ptr<System> collision_system;
+	std::unique_ptr<System> morton_sort_system;
 	std::unique_ptr<System> enemy_movement_system;
 	std::unique_ptr<System> draw_system;
 	std::unique_ptr<System> input_system;
@@ -113,13 +122,19 @@ struct GameplayState : public State {
 	SubState saved_state {SubState::Normal};
 
 	olc::Pixel background_color {olc::VERY_DARK_GREY};
+	// F3 shows the DrawStats of the last frame
+	bool show_draw_stats {false};
+
+	// Enemies caught in the explosion being handled, reused between explosions
+	std::vector<entt::entity> explosion_targets;
 
-	explicit GameplayState(olc::PixelGameEngine* pge) : State(pge) { }
+	// physics_step is the fixed simulation step, 1/30 is playable on slow hardware
+	explicit GameplayState(olc::PixelGameEngine* pge, float physics_step = 1.0f / 60.0f) : State(pge), physics_step(physics_step) { }
 
 	void tickEnemyTimer() {
 		auto entity = reg.create();
 		auto& s = reg.emplace<Shape>(entity, prototypes[ShapePrototypes::Square]);
-		s.color = olc::YELLOW;
+		reg.emplace<ColorComponent>(entity, olc::YELLOW);
 
 		utilities::random::uniform_real_distribution<float> dist {0, static_cast<float>(olc::utils::geom2d::pi) * 2.0f};
 		const float angle = dist(rng);
@@ -130,15 +145,16 @@ struct GameplayState : public State {
 		s.MoveTo(position);
 		reg.emplace<EnemyComponent>(entity);
 		reg.emplace<PhysicsComponent>(entity);
+		reg.emplace<ColliderComponent>(entity, CollisionLayer::Enemy);
 	}
 
 	void spawnParticle(olc::vf2d pos, olc::vf2d vel, olc::Pixel color = olc::YELLOW, ShapePrototypes type = ShapePrototypes::Triangle) {
 		auto entity = reg.create();
 		auto& s = reg.emplace<Shape>(entity, prototypes[type]);
 		s.MoveTo(pos);
-		s.color = color;
+		reg.emplace<ColorComponent>(entity, color);
 		utilities::random::uniform_real_distribution<float> dist {0, static_cast<float>(olc::utils::geom2d::pi) * 2.0f};
-		s.theta = dist(rng);
+		s.SetTheta(dist(rng));
 		reg.emplace<ParticleComponent>(entity);
 		auto& p = reg.emplace<PhysicsComponent>(entity);
 		p.friction = 0.97f;
@@ -170,6 +186,43 @@ struct GameplayState : public State {
 
 	}
 
+	// Event responding to an explosion.  Damages everything in range with one spatial query instead of a fan of bullets
+	void on_explosion(const Explosion& explosion) {
+		if(const auto* query = reg.ctx().find<SpatialQuery>()) {
+			query->InRadius(explosion.position, explosion.radius, explosion_targets);
+		}
+
+		for(auto entity : explosion_targets) {
+			if(!reg.valid(entity) || !reg.all_of<EnemyComponent, Shape>(entity)) {
+				continue;
+			}
+
+			auto& e = reg.get<EnemyComponent>(entity);
+			e.health = std::max(0.0f, e.health - explosion.damage);
+
+			// Need to handle the Dark Triad boss specially
+			if(e.health <= 0.0f && !reg.storage<DarkTriadMember>().contains(entity)) {
+				dispatcher.enqueue<EnemyDeath>(reg.get<Shape>(entity).position);
+				reg.destroy(entity);
+			}
+		}
+		explosion_targets.clear();
+
+		utilities::random::uniform_real_distribution<float> dist {0, static_cast<float>(olc::utils::geom2d::pi) * 2.0f};
+		for(int i = 0; i < explosion.particle_count; i++) {
+			spawnParticle(explosion.position, olc::vf2d{1.0f, dist(rng)}.cart(), explosion.color, ShapePrototypes::Triangle);
+		}
+
+		for(int i = 0; i < explosion.shrapnel_count; i++) {
+			SpawnBullet spawn = explosion.shrapnel;
+			spawn.position = explosion.position;
+			spawn.initial_velocity = olc::vf2d{explosion.shrapnel_speed, dist(rng)}.cart();
+			dispatcher.enqueue(spawn);
+		}
+
+		dispatcher.enqueue<PlayRandomEffect>({"explode"});
+	}
+
 	// Event responding to certain player input
 	void on_player_input(const PlayerInput& input) {
 		const auto& s = reg.get<Shape>(player_entity);
@@ -190,7 +243,7 @@ struct GameplayState : public State {
 		for(int i = 0; i < spawn.count; i++) {
 			auto entity = reg.create();
 			auto& s = reg.emplace<Shape>(entity, prototypes[spawn.type]);
-			s.color = spawn.color;
+			reg.emplace<ColorComponent>(entity, spawn.color);
 			s.scale = spawn.scale;
 
 			olc::vf2d jitter {dist_a(rng), dist_a(rng)};
@@ -198,6 +251,7 @@ struct GameplayState : public State {
 
 			auto& e = reg.emplace<EnemyComponent>(entity);
 			e.health = spawn.health;
+			reg.emplace<ColliderComponent>(entity, CollisionLayer::Enemy);
 			auto& p = reg.emplace<PhysicsComponent>(entity);
 			p.mass = spawn.mass;
 
@@ -206,13 +260,21 @@ struct GameplayState : public State {
 
 	void on_bullet_spawn(const SpawnBullet& spawn) {
 		auto entity = reg.create();
-		auto& s = reg.emplace<Shape>(entity, prototypes[spawn.shape]);
-		s.MoveTo(spawn.position);
-		s.theta = spawn.initial_velocity.y;
-		s.scale = spawn.scale;
-		s.color = spawn.color;
+		if(spawn.lightweight) {
+			auto& s = reg.emplace<Projectile>(entity, prototypes[spawn.shape]);
+			s.position = spawn.position;
+			s.theta = spawn.initial_velocity.y;
+			s.scale = spawn.scale;
+		} else {
+			auto& s = reg.emplace<Shape>(entity, prototypes[spawn.shape]);
+			s.MoveTo(spawn.position);
+			s.SetTheta(spawn.initial_velocity.y);
+			s.scale = spawn.scale;
+		}
+		reg.emplace<ColorComponent>(entity, spawn.color);
 
 		auto& b = reg.emplace<BulletComponent>(entity, spawn);
+		reg.emplace<ColliderComponent>(entity, CollisionLayer::Bullet, true, spawn.position);
 		
 		auto& p = reg.emplace<PhysicsComponent>(entity);
 		p.velocity = spawn.initial_velocity;
@@ -225,16 +287,18 @@ struct GameplayState : public State {
 		auto& s = reg.emplace<Shape>(entity, prototypes[ShapePrototypes::Triangle]);
 		auto& p = reg.emplace<PhysicsComponent>(entity);
 		s.MoveTo(spawn.position);
-		s.theta = spawn.position.y;
+		s.SetTheta(spawn.position.y);
 		s.scale = 0.4f * (1.0f + 0.1f * spawn.value);
 
 		// Generate a random green color
-		s.color.g = 192 + (rand() % 64);
-		s.color.b = rand() % 128;
-		s.color.r = rand() % 128;
+		auto& c = reg.emplace<ColorComponent>(entity).color;
+		c.g = 192 + (rand() % 64);
+		c.b = rand() % 128;
+		c.r = rand() % 128;
 
 		reg.emplace<ParticleComponent>(entity, 30.0f, 20.0f);
 		reg.emplace<ExperienceComponent>(entity, spawn.value, spawn.age);
+		reg.emplace<ColliderComponent>(entity, CollisionLayer::Experience);
 	}
 
 	void on_levelup(const LevelUp& levelup) {
@@ -284,7 +348,7 @@ struct GameplayState : public State {
 
 		// If the player is eligible for an upgrade, grant it
 		if(s.WeaponPointCount() - 2 < shape_progression.size()) {
-			auto& next_shape = prototypes[shape_progression[s.WeaponPoints().size() - 2]];
+			auto& next_shape = prototypes[shape_progression[s.WeaponPointCount() - 2]];
 			s.SetPrototype(next_shape);
 		}
 
@@ -319,6 +383,7 @@ struct GameplayState : public State {
 		dispatcher.sink<PlayerInput>().connect<&GameplayState::on_player_input>(this);
 		dispatcher.sink<SpawnDescriptor>().connect<&GameplayState::on_spawn_enemy>(this);
 		dispatcher.sink<SpawnBullet>().connect<&GameplayState::on_bullet_spawn>(this);
+		dispatcher.sink<Explosion>().connect<&GameplayState::on_explosion>(this);
 		dispatcher.sink<SpawnExperience>().connect<&GameplayState::on_experience_spawn>(this);
 		dispatcher.sink<LevelUp>().connect<&GameplayState::on_levelup>(this);
 		dispatcher.sink<LevelUpOption>().connect<&GameplayState::on_levelup_option>(this);
@@ -341,11 +406,17 @@ struct GameplayState : public State {
 		auto& s = reg.emplace<Shape>(player_entity, prototypes[ShapePrototypes::Triangle]);
 		s.MoveTo(pge->GetScreenSize() / 2.0f);
 		s.scale = 4.0f;
-		s.color = utilities::RandomBrightColor();
+		reg.emplace<ColorComponent>(player_entity, utilities::RandomBrightColor());
 		auto& physics = reg.emplace<PhysicsComponent>(player_entity);
+		reg.emplace<ColliderComponent>(player_entity, CollisionLayer::Player);
 		
 		// Create all the systems that will be run
-		physics_system = std::make_unique<PhysicsSystem>(reg, pge);
+		physics_system = std::make_unique<PhysicsSystem>(reg, pge, physics_step);
+		spatial_index_system = std::make_unique<SpatialIndexSystem>(reg, pge);
+		reg.ctx().emplace<SpatialQuery>(reg);
+		transform_system = std::make_unique<TransformSystem>(reg, pge);
+		collision_system = std::make_unique<CollisionSystem>(reg, pge);
+		morton_sort_system = std::make_unique<MortonSortSystem>(reg, pge);
 		enemy_movement_system = std::make_unique<EnemyMovementSystem>(player_entity, reg, pge);
 		draw_system = std::make_unique<DrawSystem>(player_entity, reg, pge);
 		input_system = std::make_unique<KeyboardInputSystem>(dispatcher, player_entity, reg, pge);
@@ -375,8 +446,9 @@ struct GameplayState : public State {
 			fElapsedTime = 0.0f;
 		}
 
-		if(fElapsedTime > 1.0f/60.0f) {
-			fElapsedTime = 1.0f/60.0f;
+		// Long frames are cut to one physics step, so a stall doesn't turn into a burst of steps
+		if(fElapsedTime > physics_step) {
+			fElapsedTime = physics_step;
 		}
 
 		if(next_state != current_state) {
@@ -384,6 +456,10 @@ struct GameplayState : public State {
 			current_state = next_state;
 		}
 
+		if(pge->GetKey(olc::Key::F3).bPressed) {
+			show_draw_stats = !show_draw_stats;
+		}
+
 		if(pge->GetKey(olc::Key::SPACE).bPressed) {
 			if((current_state != SubState::Pause) && (current_state != SubState::Dead) && (current_state != SubState::LevelUpScreen)) {
 				next_state = SubState::Pause;
@@ -395,6 +471,10 @@ struct GameplayState : public State {
 
 		// PreUpdates can probably always be run regardless of state
 		physics_system->PreUpdate();
+		spatial_index_system->PreUpdate();
+		transform_system->PreUpdate();
+		collision_system->PreUpdate();
+		morton_sort_system->PreUpdate();
 		enemy_movement_system->PreUpdate();
 		draw_system->PreUpdate();
 		input_system->PreUpdate();
@@ -417,6 +497,8 @@ struct GameplayState : public State {
 		music_system->OnUserUpdate(music_time);
 
 		if(current_state != SubState::LevelUpScreen) {
+			// Reorders storage, so keep it ahead of everything that iterates
+			morton_sort_system->OnUserUpdate(fElapsedTime);
 			enemy_movement_system->OnUserUpdate(fElapsedTime);
 			enemy_attack_system->OnUserUpdate(fElapsedTime);
 			experience_system->OnUserUpdate(fElapsedTime);
@@ -440,9 +522,13 @@ struct GameplayState : public State {
 
 			physics_system->OnUserUpdate(fElapsedTime);
 			//physics_system->OnUserUpdate(fElapsedTime/2.0f);
+			spatial_index_system->OnUserUpdate(fElapsedTime);
 			player_weapons_system->OnUserUpdate(fElapsedTime);
 			input_system->OnUserUpdate(fElapsedTime);
 
+			// Right before the bullets so the pairs match where everything ended up this tick
+			transform_system->OnUserUpdate(fElapsedTime);
+			collision_system->OnUserUpdate(fElapsedTime);
 			bullet_system->OnUserUpdate(fElapsedTime);
 			particle_system->OnUserUpdate(fElapsedTime);
 			
@@ -488,6 +574,11 @@ struct GameplayState : public State {
 			//pge->DrawStringDecal({10.0f, 70.0f}, std::format("Level : {}", reg.get<PlayerComponent>(player_entity).level), olc::WHITE, olc::vf2d{3.0f, 3.0f});
 			//pge->DrawStringDecal({10.0f, 100.0f}, std::format("Health: {}", reg.get<PlayerComponent>(player_entity).health), olc::WHITE, olc::vf2d{3.0f, 3.0f});
 			//pge->DrawStringDecal({10.0f, 130.0f}, std::format("Xp    : {}", reg.get<PlayerComponent>(player_entity).experience), olc::WHITE, olc::vf2d{3.0f, 3.0f});
+
+			if(show_draw_stats) {
+				const auto& stats = reg.ctx().get<DrawStats>();
+				pge->DrawStringDecal({10.0f, 100.0f}, std::format("Drawn : {}  Culled : {}  Decals : {}", stats.drawn, stats.culled, stats.submissions), olc::WHITE, olc::vf2d{2.0f, 2.0f});
+			}
 			pge->SetDrawTarget(static_cast<uint8_t>(1));
 
 			// pge->DrawStringDecal({10.0f, 70.0f}, std::format("Enemy: {}", enemyTimer), olc::WHITE, olc::vf2d{3.0f, 3.0f});
@@ -550,157 +641,6 @@ public:
 		game_states.insert(std::make_pair(GameState::Menu, std::make_unique<MenuState>(this)));
 		game_states.insert(std::make_pair(GameState::Gameplay, std::make_unique<GameplayState>(this)));
 	
-		// Create the cursor shape
-		Prototype cursor_proto;
-		cursor_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{0, -8}, {8, 8}, {0, 0}});
-		cursor_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{0, -8}, {0, 0}, {-8, 8}});
-		cursor_proto.type = ShapePrototypes::Cursor; 
-		// Cursor proto has no weapon points as it is only used for projectiles
-		prototypes.insert({ShapePrototypes::Cursor, cursor_proto});
-
-		// Create the star52 shape and the pentagon shape
-		Prototype star52_proto;
-		Prototype pentagon_proto;
-		{
-			std::array<olc::vf2d, 5> outer_points;
-
-			for(int i = 0; i < 5; i++) {
-				float outer_angle = ((90.0f - (72.0f * i)) * static_cast<float>(olc::utils::geom2d::pi)) / 180.0f;
-				outer_points[i] = olc::vf2d{-8.0f * std::cosf(outer_angle), -8.0f * std::sinf(outer_angle)};
-
-				// Both the pentagon and star52 shapes have the same weapon mount points
-				star52_proto.weapon_points.push_back(outer_points[i]);
-				pentagon_proto.weapon_points.push_back(outer_points[i]);
-			}
-
-			star52_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[0]}, {outer_points[2]}, {0.0f, 0.0f}});
-			star52_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[1]}, {outer_points[3]}, {0.0f, 0.0f}});
-			star52_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[2]}, {outer_points[4]}, {0.0f, 0.0f}});
-			star52_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[3]}, {outer_points[0]}, {0.0f, 0.0f}});
-			star52_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[4]}, {outer_points[1]}, {0.0f, 0.0f}});
-
-			pentagon_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[0]}, {outer_points[1]}, {0.0f, 0.0f}});
-			pentagon_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[1]}, {outer_points[2]}, {0.0f, 0.0f}});
-			pentagon_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[2]}, {outer_points[3]}, {0.0f, 0.0f}});
-			pentagon_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[3]}, {outer_points[4]}, {0.0f, 0.0f}});
-			pentagon_proto.tris.push_back(olc::utils::geom2d::triangle<float>{{outer_points[4]}, {outer_points[0]}, {0.0f, 0.0f}});
-
-
-			star52_proto.type = ShapePrototypes::Star5_2;
-			pentagon_proto.type = ShapePrototypes::Pentagon;
-			prototypes.insert({ShapePrototypes::Star5_2, star52_proto});
-			prototypes.insert({ShapePrototypes::Pentagon, pentagon_proto});
-		}
-
-		// Create the star62 shape and the triangle shape since they share some points
-		Prototype star62_proto;
-		Prototype triangle_proto;
-		{
-			std::array<olc::vf2d, 6> points;
-			for(int i = 0; i < 6; i++) {
-				float angle = ((90.0f - (60.0f * i)) * static_cast<float>(olc::utils::geom2d::pi)) / 180.0f;
-				points[i] = olc::vf2d{-8.0f * std::cosf(angle), -8.0f * std::sinf(angle)};
-
-				// Add the weapon points, but only half to the triangle
-				star62_proto.weapon_points.push_back(points[i]);
-				if((i % 2) == 0) {
-					triangle_proto.weapon_points.push_back(points[i]);
-				}
-			}
-
-			star62_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[0], points[2], points[4]});
-			star62_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[1], points[3], points[5]});
-			
-			triangle_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[0], points[2], points[4]});
-
-			star62_proto.type = ShapePrototypes::Star6_2;
-			triangle_proto.type = ShapePrototypes::Triangle; 
-			prototypes.insert({ShapePrototypes::Star6_2, star62_proto});
-			prototypes.insert({ShapePrototypes::Triangle, triangle_proto});
-		}
-
-		// Create the star82 shape, square, and cross since they share some points
-		Prototype star82_proto;
-		Prototype square_proto;
-		Prototype cross_proto;
-		{
-			std::array<olc::vf2d, 8> points;
-			for(int i = 0; i < 8; i++) {
-				float angle = ((90.0f - (45.0f * i)) * static_cast<float>(olc::utils::geom2d::pi)) / 180.0f;
-				points[i] = olc::vf2d{-8.0f * std::cosf(angle), -8.0f * std::sinf(angle)};
-
-				star82_proto.weapon_points.push_back(points[i]);
-				cross_proto.weapon_points.push_back(points[i]);
-				if((i % 2) == 1) {
-					square_proto.weapon_points.push_back(points[i]);
-				}
-			}
-
-			star82_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[0], points[2], points[4]});
-			star82_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[1], points[3], points[5]});
-			star82_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[4], points[6], points[0]});
-			star82_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[5], points[7], points[1]});
-
-			square_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[1], points[3], points[5]});
-			square_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[5], points[7], points[1]});
-
-			cross_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[0], points[1], points[4]});
-			cross_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[4], points[5], points[0]});
-			cross_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[2], points[3], points[6]});
-			cross_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[6], points[7], points[2]});
-
-			
-			
-			star82_proto.type = ShapePrototypes::Star8_2;
-			square_proto.type = ShapePrototypes::Square;
-			cross_proto.type = ShapePrototypes::Cross;
-			prototypes.insert({ShapePrototypes::Star8_2, star82_proto});
-			prototypes.insert({ShapePrototypes::Square, square_proto});
-			prototypes.insert({ShapePrototypes::Cross, cross_proto});
-
-		}
-
-		// Create the star93 shape
-		Prototype star93_proto;
-		{
-			std::array<olc::vf2d, 9> points;
-			for(int i = 0; i < 9; i++) {
-				float angle = ((90.0f - (40.0f * i)) * static_cast<float>(olc::utils::geom2d::pi)) / 180.0f;
-				points[i] = olc::vf2d{-8.0f * std::cosf(angle), -8.0f * std::sinf(angle)};
-
-				star93_proto.weapon_points.push_back(points[i]);
-			}
-
-			star93_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[0], points[3], points[6]});
-			star93_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[1], points[4], points[7]});
-			star93_proto.tris.push_back(olc::utils::geom2d::triangle<float>{points[2], points[5], points[8]});
-
-			star93_proto.type = ShapePrototypes::Star9_3;
-			prototypes.insert({ShapePrototypes::Star9_3, star93_proto});
-		}
-
-		Prototype star73_proto;
-		{
-			std::array<olc::vf2d, 7> points;
-			for(int i = 0; i < 7; i++) {
-				float angle = ((90.0f - ((360.0f/7.0f) * i)) * static_cast<float>(olc::utils::geom2d::pi)) / 180.0f;
-				points[i] = olc::vf2d{-8.0f * std::cosf(angle), -8.0f * std::sinf(angle)};
-
-				star73_proto.weapon_points.push_back(points[i]);
-			}
-
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[0], points[3], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[1], points[4], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[2], points[5], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[3], points[6], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[4], points[0], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[5], points[1], {0.0f, 0.0f}));
-			star73_proto.tris.push_back(olc::utils::geom2d::triangle<float>(points[6], points[2], {0.0f, 0.0f}));
-
-			star73_proto.type = ShapePrototypes::Star7_3;
-			prototypes.insert({ShapePrototypes::Star7_3, star73_proto});
-		}
-
 		// Load audio
 		audio_manager.Load("assets/audio_info", &ma);
 		//audio_manager.Load()
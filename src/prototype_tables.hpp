@@ -0,0 +1,74 @@
+#pragma once
+
+#include "shape.hpp"
+
+#include "utilities/utility.hpp"
+
+#include <array>
+#include <initializer_list>
+
+// Shape-space triangles and weapon mount points of a prototype, generated at compile time.
+// The runtime Prototype in the PrototypeList is built from these
+struct PrototypeTable {
+	struct Point {
+		float x {0.0f};
+		float y {0.0f};
+	};
+
+	std::array<std::array<Point, 3>, max_prototype_triangles> tris {};
+	size_t tri_count {0};
+	std::array<Point, max_prototype_weapon_points> weapon_points {};
+	size_t weapon_point_count {0};
+};
+
+namespace prototype_data {
+	// Index standing for the shape origin in the triangle lists of Ring
+	constexpr int center = -1;
+
+	// Point i of count spread evenly on a circle of radius 8, starting straight up and going clockwise
+	constexpr PrototypeTable::Point RingPoint(int i, int count) {
+		const double angle = (90.0 - (360.0 / count) * i) * 3.14159265358979323846 / 180.0;
+		return {static_cast<float>(-8.0 * utilities::ConstexprCos(angle)), static_cast<float>(-8.0 * utilities::ConstexprSin(angle))};
+	}
+
+	// Prototype made of points on the ring.  Triangles index the ring points, weapon points are every
+	// weapon_step-th ring point starting from weapon_first
+	constexpr PrototypeTable Ring(int count, std::initializer_list<std::array<int, 3>> tris, int weapon_first, int weapon_step) {
+		PrototypeTable table;
+		for(const auto& t : tris) {
+			for(int v = 0; v < 3; v++) {
+				table.tris[table.tri_count][v] = (t[v] == center) ? PrototypeTable::Point{} : RingPoint(t[v], count);
+			}
+			table.tri_count++;
+		}
+		for(int i = weapon_first; i < count; i += weapon_step) {
+			table.weapon_points[table.weapon_point_count++] = RingPoint(i, count);
+		}
+		return table;
+	}
+
+	constexpr std::array<PrototypeTable, static_cast<size_t>(ShapePrototypes::Count)> Build() {
+		std::array<PrototypeTable, static_cast<size_t>(ShapePrototypes::Count)> tables {};
+		const auto at = [&tables](ShapePrototypes type) -> PrototypeTable& { return tables[static_cast<size_t>(type)]; };
+
+		// The cursor has no weapon points as it is only used for projectiles
+		auto& cursor = at(ShapePrototypes::Cursor);
+		cursor.tris[0] = {{{0.0f, -8.0f}, {8.0f, 8.0f}, {0.0f, 0.0f}}};
+		cursor.tris[1] = {{{0.0f, -8.0f}, {0.0f, 0.0f}, {-8.0f, 8.0f}}};
+		cursor.tri_count = 2;
+
+		at(ShapePrototypes::Triangle) = Ring(6, {{0, 2, 4}}, 0, 2);
+		at(ShapePrototypes::Square) = Ring(8, {{1, 3, 5}, {5, 7, 1}}, 1, 2);
+		at(ShapePrototypes::Pentagon) = Ring(5, {{0, 1, center}, {1, 2, center}, {2, 3, center}, {3, 4, center}, {4, 0, center}}, 0, 1);
+		at(ShapePrototypes::Star5_2) = Ring(5, {{0, 2, center}, {1, 3, center}, {2, 4, center}, {3, 0, center}, {4, 1, center}}, 0, 1);
+		at(ShapePrototypes::Star6_2) = Ring(6, {{0, 2, 4}, {1, 3, 5}}, 0, 1);
+		at(ShapePrototypes::Star7_3) = Ring(7, {{0, 3, center}, {1, 4, center}, {2, 5, center}, {3, 6, center}, {4, 0, center}, {5, 1, center}, {6, 2, center}}, 0, 1);
+		at(ShapePrototypes::Star8_2) = Ring(8, {{0, 2, 4}, {1, 3, 5}, {4, 6, 0}, {5, 7, 1}}, 0, 1);
+		at(ShapePrototypes::Star9_3) = Ring(9, {{0, 3, 6}, {1, 4, 7}, {2, 5, 8}}, 0, 1);
+		at(ShapePrototypes::Cross) = Ring(8, {{0, 1, 4}, {4, 5, 0}, {2, 3, 6}, {6, 7, 2}}, 0, 1);
+
+		return tables;
+	}
+}
+
+constexpr std::array<PrototypeTable, static_cast<size_t>(ShapePrototypes::Count)> prototype_tables = prototype_data::Build();
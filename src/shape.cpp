@@ -1,29 +1,220 @@
 #include "shape.hpp"
+#include "prototype_tables.hpp"
 
 #include "utilities/utility.hpp"
 
-Shape::iterator Shape::begin() {
-	return tris.begin();
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+
+namespace {
+    using Polygon = std::vector<olc::vf2d>;
+
+    // Signed area, positive for counter-clockwise polygons
+    float SignedArea(const Polygon& poly) {
+        float area = 0.0f;
+        for(size_t i = 0; i < poly.size(); i++) {
+            area += poly[i].cross(poly[(i + 1) % poly.size()]);
+        }
+        return area * 0.5f;
+    }
+
+    // Andrew's monotone chain, returns the hull counter-clockwise without collinear points
+    Polygon ConvexHull(Polygon points) {
+        std::sort(points.begin(), points.end(), [](const olc::vf2d& a, const olc::vf2d& b) {
+            return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+        });
+
+        if(points.size() < 3) {
+            return points;
+        }
+
+        Polygon hull(points.size() * 2);
+        size_t k = 0;
+        for(size_t i = 0; i < points.size(); i++) {
+            while(k >= 2 && (hull[k - 1] - hull[k - 2]).cross(points[i] - hull[k - 2]) <= 0.0f) {
+                k--;
+            }
+            hull[k++] = points[i];
+        }
+        for(size_t i = points.size() - 1, t = k + 1; i > 0; i--) {
+            while(k >= t && (hull[k - 1] - hull[k - 2]).cross(points[i - 1] - hull[k - 2]) <= 0.0f) {
+                k--;
+            }
+            hull[k++] = points[i - 1];
+        }
+
+        hull.resize(k - 1);
+        return hull;
+    }
+
+    // Sutherland-Hodgman clip of one convex polygon against another, both counter-clockwise
+    Polygon Clip(const Polygon& subject, const Polygon& clip) {
+        Polygon output = subject;
+
+        for(size_t i = 0; i < clip.size() && !output.empty(); i++) {
+            const olc::vf2d a = clip[i];
+            const olc::vf2d b = clip[(i + 1) % clip.size()];
+            const auto inside = [&](const olc::vf2d& p) { return (b - a).cross(p - a) >= 0.0f; };
+
+            Polygon input;
+            input.swap(output);
+
+            for(size_t j = 0; j < input.size(); j++) {
+                const olc::vf2d p = input[j];
+                const olc::vf2d q = input[(j + 1) % input.size()];
+
+                if(inside(q)) {
+                    if(!inside(p)) {
+                        output.push_back(p + (q - p) * ((b - a).cross(a - p) / (b - a).cross(q - p)));
+                    }
+                    output.push_back(q);
+                } else if(inside(p)) {
+                    output.push_back(p + (q - p) * ((b - a).cross(a - p) / (b - a).cross(q - p)));
+                }
+            }
+        }
+
+        return output;
+    }
+
+    // Area of the union of convex polygons by inclusion-exclusion.  Only meant for the handful of
+    // triangles in a prototype
+    float UnionArea(const std::vector<Polygon>& polys) {
+        float area = 0.0f;
+        const uint32_t subsets = 1u << polys.size();
+
+        for(uint32_t mask = 1; mask < subsets; mask++) {
+            Polygon overlap;
+            int count = 0;
+            for(size_t i = 0; i < polys.size(); i++) {
+                if(mask & (1u << i)) {
+                    overlap = (count == 0) ? polys[i] : Clip(overlap, polys[i]);
+                    count++;
+                }
+            }
+
+            if(overlap.size() >= 3) {
+                area += ((count % 2) ? 1.0f : -1.0f) * std::abs(SignedArea(overlap));
+            }
+        }
+
+        return area;
+    }
 }
 
-Shape::iterator Shape::end() {
-    return tris.end();
+void Prototype::UpdateBounds() {
+    olc::vf2d min {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    olc::vf2d max {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    radius = 0.0f;
+
+    for(const auto& t : tris) {
+        for(const auto& p : t.pos) {
+            min = min.min(p);
+            max = max.max(p);
+            radius = std::max(radius, p.mag());
+        }
+    }
+
+    bounds = {min, max - min};
 }
 
-Shape::const_iterator Shape::begin() const {
-    return tris.cbegin();
+void Prototype::UpdateHulls() {
+    // World geometry computed on the spot is stored inline
+    assert(tris.size() <= max_prototype_triangles && weapon_points.size() <= max_prototype_weapon_points);
+    hulls.clear();
+
+    // Every triangle as a counter-clockwise polygon
+    std::vector<Polygon> remaining;
+    for(const auto& t : tris) {
+        Polygon poly {t.pos[0], t.pos[1], t.pos[2]};
+        if(SignedArea(poly) < 0.0f) {
+            std::swap(poly[1], poly[2]);
+        }
+        remaining.push_back(poly);
+    }
+
+    // Greedily take the largest group of triangles whose union is convex, which is the case
+    // exactly when the union has the same area as its convex hull
+    while(!remaining.empty()) {
+        uint32_t best_mask = 1;
+        size_t best_count = 0;
+        Polygon best_hull = remaining[0];
+
+        const uint32_t subsets = 1u << remaining.size();
+        for(uint32_t mask = 1; mask < subsets; mask++) {
+            const size_t count = std::popcount(mask);
+            if(count <= best_count) {
+                continue;
+            }
+
+            std::vector<Polygon> group;
+            Polygon group_points;
+            for(size_t i = 0; i < remaining.size(); i++) {
+                if(mask & (1u << i)) {
+                    group.push_back(remaining[i]);
+                    group_points.insert(group_points.end(), remaining[i].begin(), remaining[i].end());
+                }
+            }
+
+            Polygon hull = ConvexHull(group_points);
+            const float hull_area = SignedArea(hull);
+            if(std::abs(hull_area - UnionArea(group)) <= hull_area * 1e-3f) {
+                best_mask = mask;
+                best_count = count;
+                best_hull = std::move(hull);
+            }
+        }
+
+        ConvexPolygon convex;
+        convex.points = best_hull;
+        for(size_t i = 0; i < best_hull.size(); i++) {
+            const olc::vf2d edge = best_hull[(i + 1) % best_hull.size()] - best_hull[i];
+            convex.normals.push_back({edge.y, -edge.x});
+        }
+        hulls.push_back(convex);
+
+        for(size_t i = remaining.size(); i > 0; i--) {
+            if(best_mask & (1u << (i - 1))) {
+                remaining.erase(remaining.begin() + (i - 1));
+            }
+        }
+    }
 }
 
-Shape::const_iterator Shape::end() const {
-    return tris.cend();
+const PrototypeList prototypes;
+
+PrototypeList::PrototypeList() {
+    for(size_t i = 0; i < items.size(); i++) {
+        const auto& table = prototype_tables[i];
+        auto& proto = items[i];
+        proto.type = static_cast<ShapePrototypes>(i);
+
+        const auto point = [](const PrototypeTable::Point& p) { return olc::vf2d{p.x, p.y}; };
+        for(size_t t = 0; t < table.tri_count; t++) {
+            proto.tris.push_back({point(table.tris[t][0]), point(table.tris[t][1]), point(table.tris[t][2])});
+        }
+        for(size_t w = 0; w < table.weapon_point_count; w++) {
+            proto.weapon_points.push_back(point(table.weapon_points[w]));
+        }
+
+        // Bounds and convex pieces are derived from the finished triangles
+        proto.UpdateBounds();
+        proto.UpdateHulls();
+    }
 }
 
 void Shape::SetPrototype(const Prototype& proto) {
-    prototype = &proto;
+    type = proto.type;
 }
 
-void Shape::Draw(olc::PixelGameEngine* pge) const {
-    for (const auto& t : tris) {
+const Prototype& Shape::GetPrototype() const {
+    return prototypes[type];
+}
+
+void Shape::Draw(olc::PixelGameEngine* pge, olc::Pixel color) const {
+    for (const auto& t : WorldTriangles()) {
         pge->FillTriangleDecal(t.pos[0], t.pos[1], t.pos[2], color);
     }
 }
@@ -33,13 +224,37 @@ olc::vf2d Shape::Translate(olc::vf2d pos, const olc::vf2d& sc) const {
     return utilities::rotate(pos, sc) * scale + position;
 }
 
+float Shape::Theta() const {
+    return theta;
+}
+
+void Shape::SetTheta(float angle) {
+    theta = angle;
+    rotation = olc::vf2d{std::sinf(theta), std::cosf(theta)};
+}
+
+void Shape::Rotate(float angle, olc::vf2d step) {
+    theta += angle;
+    rotation = olc::vf2d{
+        rotation.x * step.y + rotation.y * step.x,
+        rotation.y * step.y - rotation.x * step.x
+    };
+    // Pull the pair back to unit length so rounding errors don't build up.  First order is plenty this close to 1
+    rotation = rotation * ((3.0f - rotation.mag2()) * 0.5f);
+}
+
+olc::vf2d Shape::Rotation() const {
+    return rotation;
+}
+
 void Shape::MoveTo(olc::vf2d new_position) {
     position = new_position;
-    const auto sc = olc::vf2d{std::sinf(theta), std::cosf(theta)};
-
-    tris.clear();
+}
 
-    for(const auto& t : *prototype) {
+Shape::Triangles Shape::WorldTriangles() const {
+    const auto sc = Rotation();
+    Triangles tris;
+    for(const auto& t : GetPrototype()) {
         tris.push_back(
             {
                 Translate(t.pos[0], sc),
@@ -48,29 +263,86 @@ void Shape::MoveTo(olc::vf2d new_position) {
             }
         );
     }
+    return tris;
 }
 
-bool Shape::intersects(const Shape& other) const {
-    for(const auto& t : other) {
-        for(const auto& self_t : tris) {
-            if(olc::utils::geom2d::overlaps(t, self_t)) {
-                return true;
-            }
-        }
+bool Shape::BoundsOverlap(const Shape& other) const {
+    const float r = Radius() + other.Radius();
+    if((position - other.position).mag2() > r * r) {
+        return false;
     }
 
-    return false;
-};
+    return olc::utils::geom2d::overlaps(Bounds(), other.Bounds());
+}
+
+float Shape::Radius() const {
+    return GetPrototype().radius * scale;
+}
+
+olc::utils::geom2d::rect<float> Shape::Bounds() const {
+    const auto sc = Rotation();
 
-const std::vector<olc::vf2d>& Shape::WeaponPoints() {
+    // Rotate the prototype box and take the box around that.  This avoids touching every vertex
+    const olc::vf2d half_size = GetPrototype().bounds.size * 0.5f;
+    const olc::vf2d extent = olc::vf2d{
+        std::abs(sc.y) * half_size.x + std::abs(sc.x) * half_size.y,
+        std::abs(sc.x) * half_size.x + std::abs(sc.y) * half_size.y
+    } * scale;
+    const olc::vf2d center = Translate(GetPrototype().bounds.middle(), sc);
+
+    return {center - extent, extent * 2.0f};
+}
+
+olc::utils::geom2d::rect<float> Shape::SweptBounds(olc::vf2d previous) const {
+    const auto bounds = Bounds();
+    const olc::vf2d sweep = previous - position;
+    return {bounds.pos + sweep.min({0.0f, 0.0f}), bounds.size + olc::vf2d{std::abs(sweep.x), std::abs(sweep.y)}};
+}
+
+olc::vf2d Shape::WeaponPoint(size_t i) const {
+    return Translate(GetPrototype().weapon_points[i], rotation);
+}
+
+size_t Shape::WeaponPointCount() const {
+    return GetPrototype().weapon_points.size();
+}
+
+void Projectile::Draw(olc::PixelGameEngine* pge, olc::Pixel color) const {
+    for(const auto& t : WorldTriangles()) {
+        pge->FillTriangleDecal(t.pos[0], t.pos[1], t.pos[2], color);
+    }
+}
+
+Shape::Triangles Projectile::WorldTriangles() const {
     const auto sc = olc::vf2d{std::sinf(theta), std::cosf(theta)};
-    weapon_points.clear();
-    for(auto p : prototype->weapon_points) {
-        weapon_points.push_back(Translate(p, sc));
+    Shape::Triangles tris;
+    for(const auto& t : GetPrototype()) {
+        tris.push_back(
+            {
+                utilities::rotate(t.pos[0], sc) * scale + position,
+                utilities::rotate(t.pos[1], sc) * scale + position,
+                utilities::rotate(t.pos[2], sc) * scale + position,
+            }
+        );
     }
-    return weapon_points;
+    return tris;
 }
 
-size_t Shape::WeaponPointCount() const {
-    return prototype->weapon_points.size();
+const Prototype& Projectile::GetPrototype() const {
+    return prototypes[type];
+}
+
+float Projectile::Radius() const {
+    return GetPrototype().radius * scale;
+}
+
+olc::utils::geom2d::rect<float> Projectile::Bounds() const {
+    const float r = Radius();
+    return {position - olc::vf2d{r, r}, olc::vf2d{r, r} * 2.0f};
+}
+
+olc::utils::geom2d::rect<float> Projectile::SweptBounds(olc::vf2d previous) const {
+    const olc::vf2d sweep = previous - position;
+    const olc::utils::geom2d::rect<float> b = Bounds();
+    return {b.pos + sweep.min({0.0f, 0.0f}), b.size + olc::vf2d{std::abs(sweep.x), std::abs(sweep.y)}};
 }
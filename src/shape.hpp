@@ -1,12 +1,13 @@
 #pragma once
 
 #include "utilities/olcUTIL_Geometry2D.h"
+#include "utilities/static_vector.hpp"
 
 #include "olcPixelGameEngine.h"
 
 #include <vector>
 
-enum class ShapePrototypes {
+enum class ShapePrototypes : uint8_t {
 	Triangle,
 	Square,
 	Cursor,
@@ -16,11 +17,25 @@ enum class ShapePrototypes {
 	Star7_3,
 	Star8_2,
 	Star9_3,
-	Cross
+	Cross,
+	// Number of prototypes, not a shape
+	Count
 };
 
 extern std::array<ShapePrototypes, 7> shape_progression;
 
+// Largest prototype, so that world geometry computed on the spot fits inline.  Checked by Prototype::UpdateHulls
+constexpr size_t max_prototype_triangles = 7;
+constexpr size_t max_prototype_weapon_points = 9;
+
+// Convex piece of a prototype used by the separating axis test
+struct ConvexPolygon {
+	// Counter-clockwise vertices
+	std::vector<olc::vf2d> points;
+	// Edge normals, normals[i] is perpendicular to points[i] -> points[i + 1]
+	std::vector<olc::vf2d> normals;
+};
+
 struct Prototype {
 	using iterator = std::vector<olc::utils::geom2d::triangle<float>>::iterator;
 	using const_iterator = std::vector<olc::utils::geom2d::triangle<float>>::const_iterator;
@@ -41,52 +56,128 @@ struct Prototype {
 		return tris.cend();
 	}
 
+	// Recompute radius and bounds from tris.  Must be called once the triangles are final
+	void UpdateBounds();
+
+	// Split the union of tris into as few convex polygons as possible.  Must be called once the triangles are final
+	void UpdateHulls();
+
 	std::vector<olc::utils::geom2d::triangle<float>> tris;
 	std::vector<olc::vf2d> weapon_points;
-    ShapePrototypes type;
+    ShapePrototypes type {ShapePrototypes::Count};
+
+	// Distance from the shape origin to the furthest vertex
+	float radius {0.0f};
+	// Shape-space axis aligned bounding box
+	olc::utils::geom2d::rect<float> bounds {};
+	// Convex decomposition covering exactly the same area as tris
+	std::vector<ConvexPolygon> hulls;
 };
 
-// Map of the potential prototypes
-extern std::map<ShapePrototypes, Prototype> prototypes;
+// Every prototype indexed by ShapePrototypes, built from the compile time prototype_tables before main runs
+class PrototypeList {
+public:
+	PrototypeList();
 
-struct Shape {
-	using iterator = std::vector<olc::utils::geom2d::triangle<float>>::iterator;
-	using const_iterator = std::vector<olc::utils::geom2d::triangle<float>>::const_iterator;
+	const Prototype& operator[](ShapePrototypes type) const {
+		return items[static_cast<size_t>(type)];
+	}
 
-	Shape(const Prototype& other) : tris(other.tris), prototype(&other) { }
-    Shape(const Shape& other) : tris(other.tris), prototype(other.prototype), scale(other.scale), theta(other.theta), position(other.position), color(other.color) {}
+	size_t size() const {
+		return items.size();
+	}
 
-	iterator begin();
+private:
+	std::array<Prototype, static_cast<size_t>(ShapePrototypes::Count)> items;
+};
 
-	iterator end();
+extern const PrototypeList prototypes;
 
-	const_iterator begin() const;
+// Instance of a Prototype.  Only holds the transform, the world geometry is built for every shape at
+// once by the TransformSystem into the WorldGeometry buffer
+struct Shape {
+	using Triangles = utilities::StaticVector<olc::utils::geom2d::triangle<float>, max_prototype_triangles>;
 
-	const_iterator end() const;
+	Shape(const Prototype& other) : type(other.type) {}
 
 	void SetPrototype(const Prototype& proto);
 
-	void Draw(olc::PixelGameEngine* pge) const;
+	const Prototype& GetPrototype() const;
+
+	// Transforms the prototype while drawing.  Prefer the WorldGeometry buffer for shapes in the registry
+	void Draw(olc::PixelGameEngine* pge, olc::Pixel color) const;
 
 	// Scale, Rotate, and Translate a point from shape-space to world-space.  Rotation vector must be provided separately
 	olc::vf2d Translate(olc::vf2d pos, const olc::vf2d& sc) const;
 
+	// Angle in radians.  The sin/cos pair is kept alongside it, so it can only change through SetTheta and Rotate
+	float Theta() const;
+
+	void SetTheta(float angle);
+
+	// Turn by angle.  step is {sin(angle), cos(angle)}, applied to the cached pair by complex multiplication
+	void Rotate(float angle, olc::vf2d step);
+
+	// sin and cos of theta, the rotation vector Translate takes
+	olc::vf2d Rotation() const;
+
 	void MoveTo(olc::vf2d new_position);
 
-	bool intersects(const Shape& other) const;
+	// World triangles computed on the spot
+	Triangles WorldTriangles() const;
+
+	// Cheap rejection test on the bounding circles and boxes.  False means the shapes cannot intersect
+	bool BoundsOverlap(const Shape& other) const;
+
+	// World-space bounding circle radius around position
+	float Radius() const;
 
-	const std::vector<olc::vf2d>& WeaponPoints();
+	// World-space axis aligned bounding box
+	olc::utils::geom2d::rect<float> Bounds() const;
+
+	// Bounds grown to cover the path from previous to position
+	olc::utils::geom2d::rect<float> SweptBounds(olc::vf2d previous) const;
+
+	// World position of weapon mount point i
+	olc::vf2d WeaponPoint(size_t i) const;
 
 	size_t WeaponPointCount() const ;
 
 	float scale {1.0f};
-	float theta {0.0f};
 	olc::vf2d position {0.0f, 0.0f};
-	olc::Pixel color {olc::MAGENTA};
 
-	virtual ~Shape() = default;
 protected:
-	std::vector<olc::utils::geom2d::triangle<float>> tris;
-	std::vector<olc::vf2d> weapon_points;
-	const Prototype* prototype;
+	ShapePrototypes type;
+	float theta {0.0f};
+	// sin and cos of theta
+	olc::vf2d rotation {0.0f, 1.0f};
+};
+static_assert(sizeof(Shape) <= 28, "Shape is streamed by the physics, transform and collision passes");
+
+// Lightweight stand-in for Shape used by small, numerous bullets.  Only keeps a transform and
+// collides as a circle, the prototype triangles are transformed when drawn
+struct Projectile {
+	Projectile(const Prototype& proto) : type(proto.type) {}
+
+	void Draw(olc::PixelGameEngine* pge, olc::Pixel color) const;
+
+	// World triangles computed on the spot
+	Shape::Triangles WorldTriangles() const;
+
+	// Collision radius around position, the bounding circle of the prototype
+	float Radius() const;
+
+	// World-space axis aligned box around the collision circle
+	olc::utils::geom2d::rect<float> Bounds() const;
+
+	// Bounds grown to cover the path from previous to position
+	olc::utils::geom2d::rect<float> SweptBounds(olc::vf2d previous) const;
+
+	const Prototype& GetPrototype() const;
+
+	ShapePrototypes type;
+	float scale {1.0f};
+	float theta {0.0f};
+	olc::vf2d position {0.0f, 0.0f};
 };
+static_assert(sizeof(Projectile) <= 20, "Projectile is streamed by the physics and collision passes");
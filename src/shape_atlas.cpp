@@ -0,0 +1,91 @@
+#include "shape_atlas.hpp"
+
+#include "utilities/utility.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace {
+    // Samples per pixel along each axis when rasterizing, so edges come out anti-aliased
+    constexpr int supersample = 4;
+
+    // True if p is inside the triangle, whichever way it winds
+    bool InTriangle(const olc::utils::geom2d::triangle<float>& t, olc::vf2d p) {
+        const float d0 = (t.pos[1] - t.pos[0]).cross(p - t.pos[0]);
+        const float d1 = (t.pos[2] - t.pos[1]).cross(p - t.pos[1]);
+        const float d2 = (t.pos[0] - t.pos[2]).cross(p - t.pos[2]);
+        return (d0 >= 0.0f && d1 >= 0.0f && d2 >= 0.0f) || (d0 <= 0.0f && d1 <= 0.0f && d2 <= 0.0f);
+    }
+}
+
+ShapeAtlas::ShapeAtlas() : sheet(256, 256) {
+    for(size_t type = 0; type < cells.size(); type++) {
+        for(size_t level = 0; level < scales.size(); level++) {
+            Rasterize(prototypes[static_cast<ShapePrototypes>(type)], scales[level], cells[type][level]);
+        }
+    }
+    sheet.Upload();
+}
+
+bool ShapeAtlas::Covers(float scale) {
+    return scale > 0.0f && scale <= scales.back();
+}
+
+void ShapeAtlas::Add(TriangleList& list, ShapePrototypes type, olc::vf2d position, olc::vf2d rotation, float scale, olc::Pixel color) const {
+    // Smallest cell at least as large as the shape, so the quad is only ever scaled down
+    size_t level = 0;
+    while(level + 1 < scales.size() && scales[level] < scale) {
+        level++;
+    }
+
+    const Cell& cell = cells[static_cast<size_t>(type)][level];
+    const float half = cell.region.size.x * 0.5f;
+    const float k = scale / scales[level];
+
+    std::array<olc::vf2d, 4> corners {olc::vf2d{-half, -half}, olc::vf2d{half, -half}, olc::vf2d{half, half}, olc::vf2d{-half, half}};
+    for(auto& c : corners) {
+        c = utilities::rotate(c * k, rotation) + position;
+    }
+
+    list.Add(corners[0], corners[1], corners[2], cell.uvs[0], cell.uvs[1], cell.uvs[2], color);
+    list.Add(corners[0], corners[2], corners[3], cell.uvs[0], cell.uvs[2], cell.uvs[3], color);
+}
+
+olc::Decal* ShapeAtlas::GetDecal() const {
+    return sheet.GetDecal();
+}
+
+void ShapeAtlas::Rasterize(const Prototype& prototype, float scale, Cell& cell) {
+    // Square around the bounding circle with a pixel to spare, so rotating the quad never cuts the shape off
+    const int32_t half = static_cast<int32_t>(std::ceil(prototype.radius * scale)) + 1;
+    const auto region = sheet.Allocate({half * 2, half * 2});
+    assert(region && "ShapeAtlas sheet is too small");
+    cell.region = *region;
+
+    const olc::vf2d first = olc::vf2d(cell.region.position);
+    const olc::vf2d size = olc::vf2d(cell.region.size);
+    cell.uvs = {sheet.UV(first), sheet.UV(first + olc::vf2d{size.x, 0.0f}), sheet.UV(first + size), sheet.UV(first + olc::vf2d{0.0f, size.y})};
+
+    // White everywhere, coverage goes in the alpha so the decal tint gives the colour
+    olc::Sprite* sprite = sheet.GetSprite();
+    for(int32_t y = 0; y < cell.region.size.y; y++) {
+        for(int32_t x = 0; x < cell.region.size.x; x++) {
+            int covered = 0;
+            for(int sy = 0; sy < supersample; sy++) {
+                for(int sx = 0; sx < supersample; sx++) {
+                    const olc::vf2d sample {x + (sx + 0.5f) / supersample, y + (sy + 0.5f) / supersample};
+                    const olc::vf2d local = (sample - olc::vf2d{static_cast<float>(half), static_cast<float>(half)}) / scale;
+                    for(const auto& t : prototype) {
+                        if(InTriangle(t, local)) {
+                            covered++;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            const auto alpha = static_cast<uint8_t>(covered * 255 / (supersample * supersample));
+            sprite->SetPixel(cell.region.position.x + x, cell.region.position.y + y, olc::Pixel(255, 255, 255, alpha));
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "shape.hpp"
+#include "triangle_list.hpp"
+
+#include "utilities/sprite_sheet.hpp"
+
+#include <array>
+
+// Every prototype rasterized in white at a few scales into one SpriteSheet, so small shapes can be drawn as a
+// single tinted, rotated quad instead of their triangles.  Built when constructed, which needs the PGE running
+class ShapeAtlas {
+public:
+	// Prototype scales that are rasterized.  Shapes up to the largest are drawn from the atlas
+	static constexpr std::array<float, 3> scales {0.25f, 0.5f, 1.0f};
+
+	ShapeAtlas();
+
+	// True if a shape of this scale is small enough to be drawn from the atlas
+	static bool Covers(float scale);
+
+	// Add the two triangles of the quad covering a shape to a list textured with GetDecal().
+	// rotation is {sin, cos} of the shape angle, and scale must be covered
+	void Add(TriangleList& list, ShapePrototypes type, olc::vf2d position, olc::vf2d rotation, float scale, olc::Pixel color) const;
+
+	olc::Decal* GetDecal() const;
+
+private:
+	// A prototype rasterized at one scale, with the shape origin in the middle of the region
+	struct Cell {
+		utilities::SpriteSheet::Region region;
+		// Texture coordinates of the region corners, clockwise from the top left
+		std::array<olc::vf2d, 4> uvs;
+	};
+
+	void Rasterize(const Prototype& prototype, float scale, Cell& cell);
+
+	utilities::SpriteSheet sheet;
+	std::array<std::array<Cell, scales.size()>, static_cast<size_t>(ShapePrototypes::Count)> cells;
+};
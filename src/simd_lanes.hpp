@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Minimal lane abstraction so the vector kernels are written once.  SimdLanes is 8 wide with AVX2,
+// 4 wide with SSE2 and falls back to ScalarLanes otherwise
+namespace simd {
+    struct ScalarLanes {
+        using type = float;
+        static constexpr size_t width = 1;
+        static type load(const float* p) { return *p; }
+        static void store(float* p, type v) { *p = v; }
+        static type set1(float v) { return v; }
+        static type add(type a, type b) { return a + b; }
+        static type sub(type a, type b) { return a - b; }
+        static type mul(type a, type b) { return a * b; }
+        static type min(type a, type b) { return std::min(a, b); }
+        static type max(type a, type b) { return std::max(a, b); }
+        // Bit mask of the lanes where a < b
+        static int less(type a, type b) { return a < b ? 1 : 0; }
+    };
+
+#if defined(__AVX2__)
+    struct SimdLanes {
+        using type = __m256;
+        static constexpr size_t width = 8;
+        static type load(const float* p) { return _mm256_loadu_ps(p); }
+        static void store(float* p, type v) { _mm256_storeu_ps(p, v); }
+        static type set1(float v) { return _mm256_set1_ps(v); }
+        static type add(type a, type b) { return _mm256_add_ps(a, b); }
+        static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+        static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+        static type min(type a, type b) { return _mm256_min_ps(a, b); }
+        static type max(type a, type b) { return _mm256_max_ps(a, b); }
+        static int less(type a, type b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+    };
+#elif defined(__SSE2__)
+    struct SimdLanes {
+        using type = __m128;
+        static constexpr size_t width = 4;
+        static type load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, type v) { _mm_storeu_ps(p, v); }
+        static type set1(float v) { return _mm_set1_ps(v); }
+        static type add(type a, type b) { return _mm_add_ps(a, b); }
+        static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+        static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+        static type min(type a, type b) { return _mm_min_ps(a, b); }
+        static type max(type a, type b) { return _mm_max_ps(a, b); }
+        static int less(type a, type b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+    };
+#else
+    using SimdLanes = ScalarLanes;
+#endif
+}
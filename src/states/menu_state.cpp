@@ -1,3 +1,4 @@
+#include "components.hpp"
 #include "shape.hpp"
 #include "menu_state.hpp"
 
@@ -10,12 +11,9 @@
 Shape RandomShape() {
     ShapePrototypes type = static_cast<ShapePrototypes>(rand() % prototypes.size());
 
-    olc::Pixel color = utilities::RandomColor();
-    color.a = 150 + (rand() % 32);
     float scale = 10 + (rand() % 30);
 
     Shape shape {prototypes[type]};
-    shape.color = color;
     shape.scale = scale;
 
     return shape;
@@ -85,11 +83,12 @@ GameState MenuState::OnUserUpdate(float fElapsedTime) {
                 Shape s{prototypes[static_cast<ShapePrototypes>(rand() % prototypes.size())]};
                 s.MoveTo(l.start);
                 s.scale = 20.0f + 3.0f * dist(rng);
-                s.color = utilities::RandomColor();
-                s.color.a = 128;
+                olc::Pixel color = utilities::RandomColor();
+                color.a = 128;
                 
                 reg.emplace<LerpComponent>(entity, l);
 			    reg.emplace<Shape>(entity, s);
+			    reg.emplace<ColorComponent>(entity, color);
             }
         }
     }
@@ -107,15 +106,15 @@ GameState MenuState::OnUserUpdate(float fElapsedTime) {
 
             auto pos = utilities::lerp(l.start, l.end, l.current_time / l.total_time);
             auto sign = (entt::to_integral(entity) & 0x1) ? -1 : 1;
-            s.theta += fElapsedTime * (s.scale / 40.0f) * sign;
+            s.SetTheta(s.Theta() + fElapsedTime * (s.scale / 40.0f) * sign);
             s.MoveTo(pos);
         }
     }
 
     {
         // Draw all the shapes
-        auto view = reg.view<Shape>();
-        view.each([this](const Shape& s){s.Draw(pge);});
+        auto view = reg.view<Shape, ColorComponent>();
+        view.each([this](const Shape& s, const ColorComponent& c){s.Draw(pge, c.color);});
     }
 
     {
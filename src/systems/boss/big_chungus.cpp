@@ -36,15 +36,16 @@ void BigChungusLeadInSystem::OnUserUpdate(float fElapsedTime) {
         //std::cout << "Made Boss " << entt::to_integral(entity) << std::endl;
 
         auto& e = reg.emplace<EnemyComponent>(entity);
+        reg.emplace<ColliderComponent>(entity, CollisionLayer::Enemy);
         auto& p = reg.emplace<PhysicsComponent>(entity);
         auto& s = reg.emplace<Shape>(entity, prototypes[ShapePrototypes::Star9_3]);
+        reg.emplace<ColorComponent>(entity, olc::GREY);
 
         e.health = 7000.0f + 8000.0f * power;
         e.damage = 10.0f;
         p.angular_velocity = .30f;
         p.mass = 10.0f;
         s.scale = 80.0f;
-        s.color = olc::GREY;
         //s.position = ;
         s.MoveTo({pge->ScreenWidth() / 2.0f, -0.7f * pge->ScreenHeight()});
 
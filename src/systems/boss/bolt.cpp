@@ -0,0 +1,140 @@
+#include "bolt.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+
+float rand_float() {
+	return ((float)rand()) / RAND_MAX;
+}
+
+template<typename T>
+olc::v_2d<T> MidPoint(olc::v_2d<T> start, olc::v_2d<T> end) {
+    return (start + end) / 2;
+}
+
+const float split_chance = 0.3f;
+const float split_alpha_mod = 0.5f;
+
+void Bolt::Iterate() {
+    std::vector<LineSegment> new_segments;
+
+    for (const auto& s : segments) {
+        olc::vf2d m = MidPoint(s.line.start, s.line.end);
+        olc::vf2d sl = m - s.line.start;
+
+        //sl will be perpensidcular to the segment (s, m)
+        sl = { -sl.y, sl.x };
+
+        //move m perpendicularly a little bit
+        m = m + (rand_float() - 0.5f) * sl;
+
+        //Randomize the color of new segments a little bit
+        //Keeping the blue at full gives a nice appearance
+        float r = 0.7f + rand_float() / 3.34f;
+        float g = 0.8f + rand_float() / 5.34f;
+
+        olc::Pixel c = olc::PixelF(r, g, 1.0f, s.color.a / 255.0f);
+
+        new_segments.emplace_back(LineSegment{ {s.line.start, m}, c });
+        new_segments.emplace_back(LineSegment{ {m, s.line.end}, c });
+
+        //If we're going to split, make the split a reflection
+        //over the (s, m) line and give it a little bit of alpha
+        if (rand_float() < split_chance) {
+            olc::vf2d x = m + (m - s.line.start);
+            olc::vf2d ne = x + (x - s.line.end);
+            c.a *= split_alpha_mod;
+            new_segments.emplace_back(LineSegment{ {m, ne}, c});
+        }
+    }
+
+    segments = new_segments;
+}
+
+void Bolt::BuildGrid() {
+    olc::vf2d min {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    olc::vf2d max {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    for (const auto& s : segments) {
+        min = min.min(s.line.start).min(s.line.end);
+        max = max.max(s.line.start).max(s.line.end);
+    }
+
+    bounds = {min, max - min};
+
+    // Keep the grid to at most 128 cells across however far the forks reach
+    grid_origin = min;
+    cell_size = std::max({32.0f, (max.x - min.x) / 128.0f, (max.y - min.y) / 128.0f});
+    grid_size = olc::vi2d{static_cast<int>((max.x - min.x) / cell_size), static_cast<int>((max.y - min.y) / cell_size)} + olc::vi2d{1, 1};
+
+    // Count the segments per cell, then fill them in behind the prefix sum
+    cell_start.assign(grid_size.x * grid_size.y + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            for (size_t i = 1; i < cell_start.size(); i++) {
+                cell_start[i] += cell_start[i - 1];
+            }
+            cell_segments.resize(cell_start.back());
+        }
+
+        for (uint32_t i = 0; i < segments.size(); i++) {
+            const auto& l = segments[i].line;
+            const olc::vi2d c0 = Cell(l.start.min(l.end));
+            const olc::vi2d c1 = Cell(l.start.max(l.end));
+            for (int y = c0.y; y <= c1.y; y++) {
+                for (int x = c0.x; x <= c1.x; x++) {
+                    const int cell = y * grid_size.x + x;
+                    if (pass == 0) {
+                        cell_start[cell + 1]++;
+                    } else {
+                        cell_segments[--cell_start[cell + 1]] = i;
+                    }
+                }
+            }
+        }
+    }
+
+    // Filling in walked each cell's end, stored one slot along, back down to its start
+    for (size_t i = 0; i + 1 < cell_start.size(); i++) {
+        cell_start[i] = cell_start[i + 1];
+    }
+    cell_start.back() = static_cast<uint32_t>(cell_segments.size());
+}
+
+olc::vi2d Bolt::Cell(olc::vf2d p) const {
+    const olc::vf2d c = (p - grid_origin) / cell_size;
+    return {
+        std::clamp(static_cast<int>(c.x), 0, grid_size.x - 1),
+        std::clamp(static_cast<int>(c.y), 0, grid_size.y - 1)
+    };
+}
+
+void Bolt::Query(const olc::utils::geom2d::rect<float>& area, std::vector<uint32_t>& out) const {
+    out.clear();
+    if (cell_start.empty()) {
+        return;
+    }
+
+    const olc::vf2d area_max = area.pos + area.size;
+    const olc::vi2d c0 = Cell(area.pos);
+    const olc::vi2d c1 = Cell(area_max);
+    for (int y = c0.y; y <= c1.y; y++) {
+        for (int x = c0.x; x <= c1.x; x++) {
+            const int cell = y * grid_size.x + x;
+            for (uint32_t j = cell_start[cell]; j < cell_start[cell + 1]; j++) {
+                const auto& l = segments[cell_segments[j]].line;
+                const olc::vf2d seg_min = l.start.min(l.end);
+                const olc::vf2d seg_max = l.start.max(l.end);
+                if (seg_max.x < area.pos.x || seg_max.y < area.pos.y || seg_min.x > area_max.x || seg_min.y > area_max.y) {
+                    continue;
+                }
+
+                // A segment can sit in several cells, only report it from the cell holding the corner of the overlap
+                if (Cell(seg_min.max(area.pos)) == olc::vi2d{x, y}) {
+                    out.push_back(cell_segments[j]);
+                }
+            }
+        }
+    }
+}
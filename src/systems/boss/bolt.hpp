@@ -0,0 +1,44 @@
+#pragma once
+
+#include "olcPixelGameEngine.h"
+#include "utilities/olcUTIL_Geometry2D.h"
+
+#include <cstdint>
+#include <vector>
+
+// Uniform random float in [0, 1]
+float rand_float();
+
+struct LineSegment {
+    olc::utils::geom2d::line<float> line;
+    olc::Pixel color;  
+};
+
+struct Bolt {
+    Bolt() {};
+	Bolt(olc::vf2d start, olc::vf2d end) { segments.push_back({ {start , end} , olc::WHITE }); };
+    void Iterate();
+
+    // Bin the segments into a uniform grid so queries only look at the few near them.  Call once the bolt is finished
+    void BuildGrid();
+
+    // Indices of the segments whose bounds overlap area, each listed once
+    void Query(const olc::utils::geom2d::rect<float>& area, std::vector<uint32_t>& out) const;
+
+    // Area covered by every segment, as of the last BuildGrid
+    const olc::utils::geom2d::rect<float>& Bounds() const { return bounds; }
+
+    std::vector<LineSegment> segments;
+
+private:
+    // Grid cell of a point, clamped to the grid
+    olc::vi2d Cell(olc::vf2d p) const;
+
+    olc::utils::geom2d::rect<float> bounds {};
+    olc::vf2d grid_origin {};
+    olc::vi2d grid_size {};
+    float cell_size {32.0f};
+    // Segments of cell i are cell_segments[cell_start[i], cell_start[i + 1])
+    std::vector<uint32_t> cell_start;
+    std::vector<uint32_t> cell_segments;
+};
@@ -40,46 +40,49 @@ void DarkTriadLeadInSystem::OnUserUpdate(float fElapsedTime) {
 
         {
             auto& e = reg.emplace<EnemyComponent>(entity1);
+            reg.emplace<ColliderComponent>(entity1, CollisionLayer::Enemy);
             auto& p = reg.emplace<PhysicsComponent>(entity1);
             auto& s = reg.emplace<Shape>(entity1, prototypes[ShapePrototypes::Triangle]);
             reg.emplace<DarkTriadMember>(entity1);
+            reg.emplace<ColorComponent>(entity1, utilities::RandomDarkColor());
 
             e.health = 1000.0f * (power + 1);
             e.damage = 10.0f;
             p.angular_velocity = -1.30f;
             p.mass = 3.0f;
             s.scale = 10.0f;
-            s.color = utilities::RandomDarkColor();
             s.MoveTo({pge->ScreenWidth() / 2.0f, -0.4f * pge->ScreenHeight()});
         }
 
                 {
             auto& e = reg.emplace<EnemyComponent>(entity2);
+            reg.emplace<ColliderComponent>(entity2, CollisionLayer::Enemy);
             auto& p = reg.emplace<PhysicsComponent>(entity2);
             auto& s = reg.emplace<Shape>(entity2, prototypes[ShapePrototypes::Triangle]);
             reg.emplace<DarkTriadMember>(entity2);
+            reg.emplace<ColorComponent>(entity2, utilities::RandomDarkColor());
 
             e.health = 1000.0f * (power + 1);
             e.damage = 10.0f;
             p.angular_velocity = -1.30f;
             p.mass = 3.0f;
             s.scale = 10.0f;
-            s.color = utilities::RandomDarkColor();
             s.MoveTo({static_cast<float>(pge->ScreenWidth()) * -0.2f, 0.5f * static_cast<float>(pge->ScreenHeight())});
         }
 
                 {
             auto& e = reg.emplace<EnemyComponent>(entity3);
+            reg.emplace<ColliderComponent>(entity3, CollisionLayer::Enemy);
             auto& p = reg.emplace<PhysicsComponent>(entity3);
             auto& s = reg.emplace<Shape>(entity3, prototypes[ShapePrototypes::Triangle]);
             reg.emplace<DarkTriadMember>(entity3);
+            reg.emplace<ColorComponent>(entity3, utilities::RandomDarkColor());
 
             e.health = 1000.0f * (power + 1);
             e.damage = 10.0f;
             p.angular_velocity = -1.30f;
             p.mass = 3.0f;
             s.scale = 10.0f;
-            s.color = utilities::RandomDarkColor();
             s.MoveTo({static_cast<float>(pge->ScreenWidth()) * 1.2f, 0.5f * static_cast<float>(pge->ScreenHeight())});
         }
 
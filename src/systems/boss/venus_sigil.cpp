@@ -7,22 +7,13 @@
 #include "events.hpp"
 #include "audio_manager.hpp"
 
+#include "systems/collision.hpp"
 #include "systems/system.hpp"
 
 #include "utilities/utility.hpp"
 
-
-float rand_float() {
-	return ((float)rand()) / RAND_MAX;
-}
-
-template<typename T>
-olc::v_2d<T> MidPoint(olc::v_2d<T> start, olc::v_2d<T> end) {
-    return (start + end) / 2;
-}
-
-const float split_chance = 0.3f;
-const float split_alpha_mod = 0.5f;
+#include <algorithm>
+#include <cmath>
 
 
 VenusSigilLeadInSystem::VenusSigilLeadInSystem(int power, entt::dispatcher& dispatcher, entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : power(power), dispatcher(dispatcher), player_entity(player), System(reg, pge) {};
@@ -55,15 +46,16 @@ void VenusSigilLeadInSystem::OnUserUpdate(float fElapsedTime) {
         //std::cout << "Made Boss " << entt::to_integral(entity) << std::endl;
 
         auto& e = reg.emplace<EnemyComponent>(entity);
+        reg.emplace<ColliderComponent>(entity, CollisionLayer::Enemy);
         auto& p = reg.emplace<PhysicsComponent>(entity);
         auto& s = reg.emplace<Shape>(entity, prototypes[ShapePrototypes::Star7_3]);
+        reg.emplace<ColorComponent>(entity, olc::BLUE);
 
         e.health = 5000.0f + 2500 * power;
         e.damage = 10.0f;
         p.angular_velocity = .30f;
         p.mass = 3.0f;
         s.scale = 20.0f;
-        s.color = olc::BLUE;
         //s.position = ;
         s.MoveTo({pge->ScreenWidth() / 2.0f, -0.4f * pge->ScreenHeight()});
 
@@ -103,42 +95,6 @@ void VenusSigilLeadInSystem::OnUserUpdate(float fElapsedTime) {
 
 
 
-void Bolt::Iterate() {
-    std::vector<LineSegment> new_segments;
-
-    for (const auto& s : segments) {
-        olc::vf2d m = MidPoint(s.line.start, s.line.end);
-        olc::vf2d sl = m - s.line.start;
-
-        //sl will be perpensidcular to the segment (s, m)
-        sl = { -sl.y, sl.x };
-
-        //move m perpendicularly a little bit
-        m = m + (rand_float() - 0.5f) * sl;
-
-        //Randomize the color of new segments a little bit
-        //Keeping the blue at full gives a nice appearance
-        float r = 0.7f + rand_float() / 3.34f;
-        float g = 0.8f + rand_float() / 5.34f;
-
-        olc::Pixel c = olc::PixelF(r, g, 1.0f, s.color.a / 255.0f);
-
-        new_segments.emplace_back(LineSegment{ {s.line.start, m}, c });
-        new_segments.emplace_back(LineSegment{ {m, s.line.end}, c });
-
-        //If we're going to split, make the split a reflection
-        //over the (s, m) line and give it a little bit of alpha
-        if (rand_float() < split_chance) {
-            olc::vf2d x = m + (m - s.line.start);
-            olc::vf2d ne = x + (x - s.line.end);
-            c.a *= split_alpha_mod;
-            new_segments.emplace_back(LineSegment{ {m, ne}, c});
-        }
-    }
-
-    segments = new_segments;
-}
-
 VenusSigilBossSystem::VenusSigilBossSystem(int power, entt::dispatcher& dispatcher, entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : power(power), dispatcher(dispatcher), player_entity(player), System(reg, pge) {
     dispatcher.sink<BeginBossMain>().connect<&VenusSigilBossSystem::on_boss_main>(this);
     idle_threshold = std::max(1.0f, 3.0f - (power * 0.5f));
@@ -146,6 +102,7 @@ VenusSigilBossSystem::VenusSigilBossSystem(int power, entt::dispatcher& dispatch
 
 VenusSigilBossSystem::~VenusSigilBossSystem() {
     dispatcher.sink<BeginBossMain>().disconnect(this);
+    RemoveBolt();
 }
 
 
@@ -181,6 +138,7 @@ void VenusSigilBossSystem::IdleFunction(float fElapsedTime) {
         for (float i = 0; i < limit; i += 1) {
             bolt.Iterate();
         }
+        bolt.BuildGrid();
     }
 }
 
@@ -188,6 +146,7 @@ void VenusSigilBossSystem::HintFunction(float fElapsedTime) {
     if (state_timer > hint_threshold) {
         state_timer -= hint_threshold;
         mode = eMode::TRIGGER;
+        PublishBolt();
         //adsr.Begin();
         //adsr2.Begin();
         //ls.Trigger();
@@ -196,7 +155,11 @@ void VenusSigilBossSystem::HintFunction(float fElapsedTime) {
     const auto& p = reg.get<Shape>(player_entity).position;
     auto threshold = (25000 * state_timer / hint_threshold);
 
-    for (const auto& s : bolt.segments) {
+    const float reach = std::sqrt(threshold);
+    bolt.Query({p - olc::vf2d{reach, reach}, olc::vf2d{reach, reach} * 2.0f}, nearby_segments);
+
+    for (const auto i : nearby_segments) {
+        const auto& s = bolt.segments[i];
         if ((p - s.line.start).mag2() < threshold) {
             olc::Pixel c = { s.color.r, s.color.g, s.color.b, (uint8_t)(s.color.a * 0.25f) };
             pge->DrawLine(s.line.start, s.line.end, c);
@@ -250,6 +213,7 @@ void VenusSigilBossSystem::FadeoutFunction(float fElapsedTime) {
         state_timer -= fadeout_threshold;
         //bolts_dodged += 1;
         mode = eMode::IDLE;
+        RemoveBolt();
     }
 
 }
@@ -258,21 +222,30 @@ void VenusSigilBossSystem::on_boss_main(const BeginBossMain& boss){
     boss_entity = boss.entity;
 }
 
+void VenusSigilBossSystem::PublishBolt() {
+    RemoveBolt();
+
+    bolt_entity = reg.create();
+    reg.emplace<SegmentCollider>(bolt_entity, &bolt);
+    reg.emplace<ColliderComponent>(bolt_entity, CollisionLayer::Hazard);
+}
+
+void VenusSigilBossSystem::RemoveBolt() {
+    if(reg.valid(bolt_entity)) {
+        reg.destroy(bolt_entity);
+    }
+    bolt_entity = entt::null;
+}
+
 void VenusSigilBossSystem::CheckCollision() {
-    auto& p_shape = reg.get<Shape>(player_entity);
     if(did_hit) {
         return;
     }
 
-    for(const auto& s : bolt.segments) {
-        
-        for(const auto& t : p_shape) {
-            if(olc::utils::geom2d::overlaps(t, s.line)) {
-                did_hit = true;
-                break;
-            }
-        }
-        if(did_hit) {
+    // The bolt hits at most once
+    for(const auto& [a, b] : reg.ctx().get<ContactList>()) {
+        if(a == player_entity && b == bolt_entity) {
+            did_hit = true;
             break;
         }
     }
@@ -323,6 +296,8 @@ void VenusSigilBossSystem::OnUserUpdate(float fElapsedTime) {
     // Check if the boss has been killed
     if(!boss_dead && !reg.valid(boss_entity)) {
         boss_dead = true;
+        // Nothing reads the bolt's contacts once the fight is over
+        RemoveBolt();
         
         // Signal the death of the boss
         dispatcher.enqueue(BossKill{});
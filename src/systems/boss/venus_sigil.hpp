@@ -1,6 +1,7 @@
 #pragma once
 
 #include "boss_factory.hpp"
+#include "bolt.hpp"
 
 #include "systems/system.hpp"
 
@@ -22,19 +23,6 @@ private:
     float one_time {false};
 };
 
-struct LineSegment {
-    olc::utils::geom2d::line<float> line;
-    olc::Pixel color;  
-};
-
-struct Bolt {
-    Bolt() {};
-	Bolt(olc::vf2d start, olc::vf2d end) { segments.push_back({ {start , end} , olc::WHITE }); };
-    void Iterate();
-
-    std::vector<LineSegment> segments;
-};
-
 struct VenusSigilBossSystem : public System {
     enum class eMode {
         START, //The beginning of the game
@@ -52,6 +40,10 @@ struct VenusSigilBossSystem : public System {
 
     void on_boss_main(const BeginBossMain& boss);
 
+    // Hand the bolt to the CollisionSystem as a Hazard, or take it away again
+    void PublishBolt();
+    void RemoveBolt();
+
     void CheckCollision();
 
     //void StartFunction(float fElapsedTime);
@@ -83,6 +75,10 @@ private:
     bool did_hit {false};
 
     Bolt bolt;
+    // Collider of the bolt while it can hit the player
+    entt::entity bolt_entity {entt::null};
+    // Segments near the player, reused between queries
+    std::vector<uint32_t> nearby_segments;
 };
 
 struct VenusSigilLeadOutSystem : public System {
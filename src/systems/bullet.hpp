@@ -3,6 +3,8 @@
 #include "components.hpp"
 #include "system.hpp"
 
+#include "systems/collision.hpp"
+
 struct BulletSystem : public System {
 	BulletSystem(entt::dispatcher& dispatcher, entt::registry& reg, olc::PixelGameEngine* pge) : dispatcher(dispatcher), System(reg, pge) {};
 
@@ -13,61 +15,71 @@ struct BulletSystem : public System {
 
 		for(const auto e : view) {
 			auto [b, s] = view.get(e);
-			if ((s.position.x < -10.0f) || (s.position.y < -10.0f) || (s.position.x > pge->ScreenWidth() + 10.0f) || (s.position.y > pge->ScreenHeight() + 10.0f) || (b.duration < 0.0f)) {
+			if (OffScreen(s.position) || (b.duration < 0.0f)) {
+				reg.destroy(e);
+			}
+		}
+
+		auto projectile_view = reg.view<BulletComponent, Projectile>();
+
+		for(const auto e : projectile_view) {
+			auto [b, p] = projectile_view.get(e);
+			if (OffScreen(p.position) || (b.duration < 0.0f)) {
 				reg.destroy(e);
 			}
 		}
 	}
 
 	void OnUserUpdate(float fElapsedTime) override {
-		// Check if any enemy is overlapping any bullet and then deal damage
-		auto bullet_view = reg.view<BulletComponent, Shape>();
+		// Deal damage to every enemy a bullet is touching
+		auto bullet_view = reg.view<BulletComponent>();
 		auto enemy_view = reg.view<EnemyComponent, Shape>();
 
 		for(auto b_entity : bullet_view) {
-			auto [b, b_shape] = bullet_view.get(b_entity);
-
-			b.duration -= fElapsedTime;
-
-			for(auto e_entity : enemy_view) {
-                // Don't allow bullets to hit the same enemy twice in a row
-                if(e_entity == b.last_hit) {
-                    continue;
-                }
-
-				auto [e, e_shape] = enemy_view.get(e_entity);
-
-                // If the bullet isn't remotely close, skip the intersection check
-                if((b_shape.position - e_shape.position).mag2() > (e_shape.scale*e_shape.scale*64)) {
-                    continue;
-                }
-
-				// Check if this is a hit
-				if(b_shape.intersects(e_shape)) {
-					b.last_hit = e_entity;
-                    b.hit_count--;
-					e.health = std::max(0.0f, e.health - b.damage);
-
-					b.on_hit_func(reg, dispatcher, b_shape.position);
-
-					// Need to handle the Dark Triad boss specially
-					if(e.health <= 0.0f && !reg.storage<DarkTriadMember>().contains(e_entity)) {
-                        //std::cout << "Killing " << entt::to_integral(e_entity) << std::endl;
-                        b.on_kill_func(reg, dispatcher, e_shape.position);
-						dispatcher.enqueue<EnemyDeath>(e_shape.position);
-						reg.destroy(e_entity);
-					}
-
-					if (b.hit_count <= 0) {
-						reg.destroy(b_entity);
-						break;
-					}
-				}
+			bullet_view.get<BulletComponent>(b_entity).duration -= fElapsedTime;
+		}
+
+		// Contacts are grouped by bullet, in entity order
+		for(const auto& [b_entity, e_entity] : reg.ctx().get<ContactList>()) {
+			// The bullet may already be used up, and an earlier bullet may have destroyed the enemy this tick
+			if(!bullet_view.contains(b_entity) || !enemy_view.contains(e_entity)) {
+				continue;
+			}
+
+			auto& b = bullet_view.get<BulletComponent>(b_entity);
+
+            // Don't allow bullets to hit the same enemy twice in a row
+            if(e_entity == b.last_hit) {
+                continue;
+            }
+
+			auto [e, e_shape] = enemy_view.get(e_entity);
+			const olc::vf2d b_position = reg.all_of<Shape>(b_entity) ? reg.get<Shape>(b_entity).position : reg.get<Projectile>(b_entity).position;
+
+			b.last_hit = e_entity;
+            b.hit_count--;
+			e.health = std::max(0.0f, e.health - b.damage);
+
+			b.on_hit_func(reg, dispatcher, b_position);
+
+			// Need to handle the Dark Triad boss specially
+			if(e.health <= 0.0f && !reg.storage<DarkTriadMember>().contains(e_entity)) {
+                //std::cout << "Killing " << entt::to_integral(e_entity) << std::endl;
+                b.on_kill_func(reg, dispatcher, e_shape.position);
+				dispatcher.enqueue<EnemyDeath>(e_shape.position);
+				reg.destroy(e_entity);
 			}
 
+			if (b.hit_count <= 0) {
+				reg.destroy(b_entity);
+			}
 		}
 	}
 
 private:
+	bool OffScreen(olc::vf2d position) const {
+		return (position.x < -10.0f) || (position.y < -10.0f) || (position.x > pge->ScreenWidth() + 10.0f) || (position.y > pge->ScreenHeight() + 10.0f);
+	}
+
 	entt::dispatcher& dispatcher;
 };
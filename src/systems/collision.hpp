@@ -0,0 +1,265 @@
+#pragma once
+
+#include "components.hpp"
+#include "shape.hpp"
+#include "system.hpp"
+#include "triangle_batch.hpp"
+#include "world_geometry.hpp"
+
+#include "systems/boss/bolt.hpp"
+
+#include "utilities/entt.hpp"
+#include "utilities/parallel_for.hpp"
+#include "utilities/sweep_and_prune.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+// Two colliders that touch.  a is on the lower CollisionLayer, or the lower entity when both share a layer
+struct Contact {
+	entt::entity a;
+	entt::entity b;
+};
+
+// Every contact found by the last collision pass, sorted by a then b.  Stored in the registry context.
+// Entities may have been destroyed since, so check reg.valid before using them
+using ContactList = std::vector<Contact>;
+
+// One broadphase and narrowphase pass over every collider per tick.  The bullet, enemy attack, experience
+// and Venus Sigil boss systems only read the ContactList it publishes.  Run right after the TransformSystem,
+// the exact tests read the WorldGeometry buffer it builds
+struct CollisionSystem : public System {
+	CollisionSystem(entt::registry& reg, olc::PixelGameEngine* pge) : System(reg, pge) {
+		reg.ctx().emplace<ContactList>();
+		reg.on_destroy<ColliderComponent>().connect<&CollisionSystem::on_collider_destroyed>(this);
+
+		Collide(CollisionLayer::Bullet, CollisionLayer::Enemy);
+		Collide(CollisionLayer::Player, CollisionLayer::Enemy);
+		Collide(CollisionLayer::Player, CollisionLayer::Experience);
+		Collide(CollisionLayer::Player, CollisionLayer::Hazard);
+	};
+
+	~CollisionSystem() {
+		reg.on_destroy<ColliderComponent>().disconnect(this);
+	}
+
+	void on_collider_destroyed(entt::registry& registry, entt::entity entity) {
+		broadphase.Remove(entity);
+	}
+
+	// Let colliders on layers a and b touch
+	void Collide(CollisionLayer a, CollisionLayer b) {
+		masks[static_cast<size_t>(a)] |= LayerBit(b);
+		masks[static_cast<size_t>(b)] |= LayerBit(a);
+	}
+
+	void OnUserUpdate(float fElapsedTime) override {
+		const auto shapes = reg.view<ColliderComponent, Shape>();
+		const auto projectiles = reg.view<ColliderComponent, Projectile>();
+
+		// Swept colliders cover the whole path they took since the last pass
+		for(auto entity : shapes) {
+			const auto [c, s] = shapes.get(entity);
+			broadphase.Update(entity, c.swept ? s.SweptBounds(c.previous_position) : s.Bounds());
+		}
+		for(auto entity : projectiles) {
+			const auto [c, p] = projectiles.get(entity);
+			broadphase.Update(entity, c.swept ? p.SweptBounds(c.previous_position) : p.Bounds());
+		}
+
+		broadphase.Sort();
+
+		// Keep the pairs whose layers can touch, ordered so the lower layer comes first
+		candidates.clear();
+		for(auto [a, b] : broadphase.Pairs()) {
+			if(!reg.valid(a) || !reg.valid(b)) {
+				continue;
+			}
+
+			const auto layer_a = reg.get<ColliderComponent>(a).layer;
+			const auto layer_b = reg.get<ColliderComponent>(b).layer;
+			if(!(masks[static_cast<size_t>(layer_a)] & LayerBit(layer_b))) {
+				continue;
+			}
+
+			if((layer_b < layer_a) || (layer_a == layer_b && b < a)) {
+				std::swap(a, b);
+			}
+			candidates.push_back({a, b});
+		}
+
+		// Segment colliders span most of the screen and would pair with nearly everything in the broadphase,
+		// so pair them here with the shapes on layers they touch
+		const auto segments = reg.view<ColliderComponent, SegmentCollider>();
+		for(auto hazard : segments) {
+			const auto [hazard_collider, segment] = segments.get(hazard);
+			const uint32_t mask = masks[static_cast<size_t>(hazard_collider.layer)];
+			const auto& bounds = segment.bolt->Bounds();
+
+			for(auto entity : shapes) {
+				const auto [c, s] = shapes.get(entity);
+				if((mask & LayerBit(c.layer)) && olc::utils::geom2d::overlaps(s.Bounds(), bounds)) {
+					candidates.push_back(c.layer < hazard_collider.layer ? Contact{entity, hazard} : Contact{hazard, entity});
+				}
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const Contact& l, const Contact& r) {
+			return (l.a < r.a) || (l.a == r.a && l.b < r.b);
+		});
+
+		// Split the candidates into runs sharing the same a
+		groups.clear();
+		for(size_t last = 0; last < candidates.size();) {
+			const size_t first = last;
+			while(last < candidates.size() && candidates[last].a == candidates[first].a) {
+				last++;
+			}
+			groups.push_back({first, last});
+		}
+
+		// The exact tests only read the registry, so chunks of runs go to the worker threads.  Each chunk
+		// writes its own contact buffer and the buffers are joined in chunk order, keeping the result the same
+		// however the chunks were scheduled
+		const size_t chunk_count = (groups.size() + groups_per_chunk - 1) / groups_per_chunk;
+		scratch.resize(workers.ThreadCount());
+		chunk_contacts.resize(std::max(chunk_contacts.size(), chunk_count));
+
+		workers.Run(chunk_count, [this](size_t chunk, size_t thread) {
+			auto& out = chunk_contacts[chunk];
+			out.clear();
+			const size_t end = std::min(groups.size(), (chunk + 1) * groups_per_chunk);
+			for(size_t g = chunk * groups_per_chunk; g < end; g++) {
+				Narrowphase(groups[g].first, groups[g].second, scratch[thread], out);
+			}
+		});
+
+		auto& contacts = reg.ctx().get<ContactList>();
+		contacts.clear();
+		for(size_t chunk = 0; chunk < chunk_count; chunk++) {
+			contacts.insert(contacts.end(), chunk_contacts[chunk].begin(), chunk_contacts[chunk].end());
+		}
+
+		for(auto entity : shapes) {
+			shapes.get<ColliderComponent>(entity).previous_position = shapes.get<Shape>(entity).position;
+		}
+		for(auto entity : projectiles) {
+			projectiles.get<ColliderComponent>(entity).previous_position = projectiles.get<Projectile>(entity).position;
+		}
+	}
+
+private:
+	static uint32_t LayerBit(CollisionLayer layer) {
+		return 1u << static_cast<uint32_t>(layer);
+	}
+
+	// Per thread buffers of the narrowphase
+	struct Scratch {
+		// Shapes tested against a in the batch, in the same order as the batch owners
+		std::vector<entt::entity> batch_entities;
+		std::vector<ShapeGeometry> batch_geometry;
+		TriangleBatch batch;
+		std::vector<uint8_t> hits;
+		// Bolt segments near a
+		std::vector<uint32_t> segments;
+	};
+
+	// Whether any segment of the bolt near bounds crosses the shape
+	static bool TouchesSegment(const ShapeGeometry& shape, const olc::utils::geom2d::rect<float>& bounds, const SegmentCollider& collider, std::vector<uint32_t>& nearby) {
+		const Bolt& bolt = *collider.bolt;
+		bolt.Query(bounds, nearby);
+		for(const auto i : nearby) {
+			const auto& line = bolt.segments[i].line;
+			if(shape.IntersectsCapsule(line.start, line.end, 0.0f)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Exact tests of candidates[first, last), which all share the same a.  Only a is swept.
+	// Runs on worker threads, so it must only read the registry
+	void Narrowphase(size_t first, size_t last, Scratch& scratch, ContactList& contacts) const {
+		const entt::registry& reg = this->reg;
+		const auto& geometry = reg.ctx().get<WorldGeometry>();
+		auto& [batch_entities, batch_geometry, batch, hits, segments] = scratch;
+		const auto a = candidates[first].a;
+		const auto& collider = reg.get<ColliderComponent>(a);
+		const size_t begin = contacts.size();
+
+		if(const auto* shape = reg.try_get<Shape>(a)) {
+			const ShapeGeometry a_geometry = geometry.Get(a, *shape);
+			if(!a_geometry) {
+				return;
+			}
+
+			// Test every shape partner at once, projectiles are circles and segments are capsules without a radius
+			batch.Clear();
+			batch_entities.clear();
+			batch_geometry.clear();
+			for(size_t i = first; i < last; i++) {
+				const auto b = candidates[i].b;
+				if(const auto* other = reg.try_get<Shape>(b)) {
+					if(const ShapeGeometry b_geometry = geometry.Get(b, *other)) {
+						batch.Add(b_geometry);
+						batch_entities.push_back(b);
+						batch_geometry.push_back(b_geometry);
+					}
+				} else if(const auto* other = reg.try_get<Projectile>(b)) {
+					if(a_geometry.IntersectsCapsule(other->position, other->position, other->Radius())) {
+						contacts.push_back({a, b});
+					}
+				} else if(const auto* other = reg.try_get<SegmentCollider>(b)) {
+					if(TouchesSegment(a_geometry, shape->Bounds(), *other, segments)) {
+						contacts.push_back({a, b});
+					}
+				}
+			}
+
+			batch.Overlaps(a_geometry, hits);
+
+			for(size_t i = 0; i < batch_entities.size(); i++) {
+				// The batch only sees where a ended up, so also sweep it in case it passed straight through
+				if(hits[i] || (collider.swept && a_geometry.SweptIntersects(batch_geometry[i], collider.previous_position))) {
+					contacts.push_back({a, batch_entities[i]});
+				}
+			}
+		} else if(const auto* projectile = reg.try_get<Projectile>(a)) {
+			const olc::vf2d start = collider.swept ? collider.previous_position : projectile->position;
+
+			for(size_t i = first; i < last; i++) {
+				const auto b = candidates[i].b;
+				if(const auto* other = reg.try_get<Shape>(b)) {
+					const ShapeGeometry b_geometry = geometry.Get(b, *other);
+					if(b_geometry && b_geometry.IntersectsCapsule(start, projectile->position, projectile->Radius())) {
+						contacts.push_back({a, b});
+					}
+				} else if(const auto* other = reg.try_get<Projectile>(b)) {
+					const float r = projectile->Radius() + other->Radius();
+					if((projectile->position - other->position).mag2() <= r * r) {
+						contacts.push_back({a, b});
+					}
+				}
+			}
+		}
+
+		// Projectile partners were pushed ahead of the batch, keep the contacts of a sorted by b
+		std::sort(contacts.begin() + begin, contacts.end(), [](const Contact& l, const Contact& r) { return l.b < r.b; });
+	}
+
+	utilities::SweepAndPrune<entt::entity> broadphase;
+	// Bit mask of the layers each layer touches
+	std::array<uint32_t, static_cast<size_t>(CollisionLayer::Count)> masks {};
+
+	// Broadphase pairs that passed the layer masks, sorted like the contacts
+	std::vector<Contact> candidates;
+	// [first, last) ranges of candidates sharing the same a
+	std::vector<std::pair<size_t, size_t>> groups;
+
+	// Runs of candidates handed to a worker at a time
+	static constexpr size_t groups_per_chunk {32};
+	utilities::ParallelFor workers;
+	std::vector<Scratch> scratch;
+	std::vector<ContactList> chunk_contacts;
+};
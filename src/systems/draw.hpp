@@ -1,16 +1,82 @@
 #pragma once
 
 #include "components.hpp"
+#include "shape_atlas.hpp"
 #include "system.hpp"
+#include "triangle_list.hpp"
+#include "world_geometry.hpp"
 
 #include "utilities/entt.hpp"
 
+#include <cmath>
+
+// What the last frame drew, stored in the registry context by the DrawSystem.  Shown with F3 during gameplay
+struct DrawStats {
+	// Shapes and projectiles drawn, and skipped for being outside the screen
+	size_t drawn {0};
+	size_t culled {0};
+	// Decals submitted for all of their triangles and atlas quads
+	size_t submissions {0};
+};
+
 struct DrawSystem : public System {
-	DrawSystem(entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : player_entity(player), System(reg, pge) {};
+	DrawSystem(entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : player_entity(player), System(reg, pge) {
+		reg.ctx().emplace<DrawStats>();
+	};
 
 	void OnUserUpdate(float fElapsedTime) override {
-		const auto view = reg.view<Shape>();
-		view.each([this](entt::entity e, const Shape& s){s.Draw(pge);});
+		// Every visible shape and projectile triangle goes into one list, submitted as a handful of decals.  Projectiles,
+		// particles and experience small enough for the ShapeAtlas go into a second list as one quad each instead.
+		// Enemies, bosses and the player always draw as triangles, under the quads.
+		// Anything whose bounds miss the screen, like enemies spawning and bosses parked off screen, is skipped.
+		// Colliders were already transformed by the TransformSystem, so culling only saves their triangles.  Shapes
+		// missing from its buffer, or spawned or moved since it ran, are transformed on the spot
+		auto& stats = reg.ctx().get<DrawStats>();
+		stats = {};
+		const olc::utils::geom2d::rect<float> screen {{0.0f, 0.0f}, olc::vf2d(pge->GetScreenSize())};
+
+		const auto& geometry = reg.ctx().get<WorldGeometry>();
+		const auto& particles = reg.storage<ParticleComponent>();
+		const auto& experience = reg.storage<ExperienceComponent>();
+		const auto view = reg.view<Shape, ColorComponent>();
+		view.each([this, &geometry, &particles, &experience, &stats, &screen](entt::entity e, const Shape& s, const ColorComponent& c){
+			if(!olc::utils::geom2d::overlaps(screen, s.Bounds())) {
+				stats.culled++;
+				return;
+			}
+
+			stats.drawn++;
+			if(ShapeAtlas::Covers(s.scale) && (particles.contains(e) || experience.contains(e))) {
+				atlas.Add(sprites, s.GetPrototype().type, s.position, s.Rotation(), s.scale, c.color);
+			} else if(const auto g = geometry.Get(e, s)) {
+				for(size_t i = 0; i < g.TriangleCount(); i++) {
+					const auto t = g.Triangle(i);
+					triangles.Add(t.pos[0], t.pos[1], t.pos[2], c.color);
+				}
+			} else {
+				for(const auto& t : s.WorldTriangles()) {
+					triangles.Add(t.pos[0], t.pos[1], t.pos[2], c.color);
+				}
+			}
+		});
+		reg.view<Projectile, ColorComponent>().each([this, &stats, &screen](const Projectile& p, const ColorComponent& c){
+			if(!olc::utils::geom2d::overlaps(screen, p.Bounds())) {
+				stats.culled++;
+				return;
+			}
+
+			stats.drawn++;
+			if(ShapeAtlas::Covers(p.scale)) {
+				atlas.Add(sprites, p.type, p.position, {std::sinf(p.theta), std::cosf(p.theta)}, p.scale, c.color);
+			} else {
+				for(const auto& t : p.WorldTriangles()) {
+					triangles.Add(t.pos[0], t.pos[1], t.pos[2], c.color);
+				}
+			}
+		});
+		// Small shapes on top, so bullets stay visible over the enemies they hit
+		stats.submissions = triangles.Submit(pge);
+		stats.submissions += sprites.Submit(pge);
 
         // Draw the player weapons
         const auto& p = reg.get<PlayerComponent>(player_entity);
@@ -21,4 +87,7 @@ struct DrawSystem : public System {
 	}
 private:
     entt::entity player_entity;
+	TriangleList triangles;
+	ShapeAtlas atlas;
+	TriangleList sprites {atlas.GetDecal()};
 };
\ No newline at end of file
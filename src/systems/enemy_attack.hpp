@@ -3,6 +3,8 @@
 #include "components.hpp"
 #include "shape.hpp"
 
+#include "systems/collision.hpp"
+
 #include "utilities/entt.hpp"
 
 struct EnemyAttackSystem : public System {
@@ -13,12 +15,19 @@ struct EnemyAttackSystem : public System {
 		const auto& player_shape = reg.get<Shape>(player_entity);
 
 		for(auto entity : view) {
+			view.get<EnemyComponent>(entity).attack_timer += fElapsedTime;
+		}
+
+		// Every enemy touching the player that is ready attacks
+		for(const auto& [a, entity] : reg.ctx().get<ContactList>()) {
+			if(a != player_entity || !view.contains(entity)) {
+				continue;
+			}
+
 			const auto& s = view.get<Shape>(entity);
 			auto& e = view.get<EnemyComponent>(entity);
 
-			e.attack_timer += fElapsedTime;
-			
-			if((e.attack_timer > e.attack_cooldown) && s.intersects(player_shape)) {
+			if(e.attack_timer > e.attack_cooldown) {
 				const auto& dir = player_shape.position - s.position;
 				auto& physics = view.get<PhysicsComponent>(entity);
 				physics.force += dir.norm() * -450000.0f;
@@ -3,6 +3,8 @@
 #include "components.hpp"
 #include "system.hpp"
 
+#include "systems/collision.hpp"
+
 struct ExperienceSystem : public System {
 	ExperienceSystem(entt::dispatcher& dispatcher, entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : dispatcher(dispatcher), player_entity(player), System(reg, pge) {};
 
@@ -13,6 +15,18 @@ struct ExperienceSystem : public System {
 		auto& player_component = reg.get<PlayerComponent>(player_entity);
 		auto view = reg.view<ExperienceComponent, Shape, PhysicsComponent>();
 
+		// If the player is touching an experience, pick it up
+		for(const auto& [a, entity] : reg.ctx().get<ContactList>()) {
+			if(a != player_entity || !view.contains(entity)) {
+				continue;
+			}
+
+			player_component.experience += view.get<ExperienceComponent>(entity).value;
+			reg.destroy(entity);
+
+			dispatcher.enqueue<PlayRandomEffect>({"experience"});
+		}
+
 		float xp_range2 = player_component.experience_range * player_component.experience_range;
 		for(auto entity : view) {
 			const auto& s = view.get<Shape>(entity);
@@ -20,16 +34,6 @@ struct ExperienceSystem : public System {
 			auto& p = view.get<PhysicsComponent>(entity);
 			
 			e.age += fElapsedTime;
-			
-			// If the player is touching an experience, pick it up
-			if(s.intersects(player_shape)) {
-				const auto& xp = view.get<ExperienceComponent>(entity);
-				player_component.experience += xp.value;
-				reg.destroy(entity);
-
-				dispatcher.enqueue<PlayRandomEffect>({"experience"});
-				continue;
-			}
 
 			// If the player is somewhat close to an experience, pull it in
 			olc::vf2d distance = s.position - player_shape.position;
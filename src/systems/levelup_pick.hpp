@@ -7,9 +7,6 @@
 
 extern std::array<ShapePrototypes, 7> shape_progression;
 
-// Map of the potential prototypes
-extern std::map<ShapePrototypes, Prototype> prototypes;
-
 struct LevelUpPickSystem : public System {
 	LevelUpPickSystem(entt::dispatcher& dispatcher, entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : dispatcher(dispatcher), player_entity(player), System(reg, pge) {
 		dispatcher.sink<LevelUp>().connect<&LevelUpPickSystem::on_levelup>(this);
@@ -54,7 +51,7 @@ struct LevelUpPickSystem : public System {
 		// 	auto functor = [](entt::registry& reg, entt::entity e) {
 		// 		auto& p = reg.get<PlayerComponent>(e);
 		// 		auto& s = reg.get<Shape>(e);
-		// 		auto& next_shape = prototypes[shape_progression[s.WeaponPoints().size() - 2]];
+		// 		auto& next_shape = prototypes[shape_progression[s.WeaponPointCount() - 2]];
 		// 		s.SetPrototype(next_shape);
 		// 		//reg.erase<Shape>(e);
 		// 		//reg.emplace<Shape>(e, s, next_shape);
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "components.hpp"
+#include "shape.hpp"
+#include "system.hpp"
+
+#include "utilities/entt.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+// Every interval ticks, reorder the shape and projectile storages along a Morton (Z-order) curve of their
+// positions and have the enemy, bullet, physics and collider storages follow.  Entities close to each other on
+// screen then sit close in memory, which keeps the collision and steering loops in cache.
+// EnTT refuses to sort storage owned by a group.  None are used, so if one is ever added its owned types must come off this list
+struct MortonSortSystem : public System {
+	// An interval of 0 turns the pass off
+	MortonSortSystem(entt::registry& reg, olc::PixelGameEngine* pge, int interval = 30) : System(reg, pge), interval(interval) {};
+
+	void OnUserUpdate(float fElapsedTime) override {
+		if(interval <= 0 || ++ticks < interval) {
+			return;
+		}
+		ticks = 0;
+
+		// Enemies spawn and bosses park off screen, so start the curve a screen up and to the left
+		origin = -olc::vf2d(pge->GetScreenSize());
+
+		reg.sort<Shape>([this](const Shape& l, const Shape& r) { return Code(l.position) < Code(r.position); });
+		reg.sort<Projectile>([this](const Projectile& l, const Projectile& r) { return Code(l.position) < Code(r.position); });
+
+		reg.sort<EnemyComponent, Shape>();
+		reg.sort<PhysicsComponent, Shape>();
+		reg.sort<ColliderComponent, Shape>();
+		reg.sort<ColorComponent, Shape>();
+		// Most bullets are projectiles, the full shape ones follow the shape order through their other components
+		reg.sort<BulletComponent, Projectile>();
+	}
+
+private:
+	// Interleave the bits of the position quantized to cells of 8 pixels
+	uint32_t Code(olc::vf2d position) const {
+		const olc::vf2d cell = (position - origin) / 8.0f;
+		return Spread(static_cast<uint32_t>(std::clamp(cell.x, 0.0f, 65535.0f))) |
+		       (Spread(static_cast<uint32_t>(std::clamp(cell.y, 0.0f, 65535.0f))) << 1);
+	}
+
+	// Move the low 16 bits of v to the even bits
+	static uint32_t Spread(uint32_t v) {
+		v = (v | (v << 8)) & 0x00FF00FF;
+		v = (v | (v << 4)) & 0x0F0F0F0F;
+		v = (v | (v << 2)) & 0x33333333;
+		v = (v | (v << 1)) & 0x55555555;
+		return v;
+	}
+
+	int interval;
+	int ticks {0};
+	olc::vf2d origin {};
+};
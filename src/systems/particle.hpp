@@ -9,11 +9,11 @@ struct ParticleSystem : public System {
 	ParticleSystem(entt::registry& reg, olc::PixelGameEngine* pge) : System(reg, pge) {};
 
 	void OnUserUpdate(float fElapsedTime) override {
-		const auto& view = reg.view<ParticleComponent, Shape>();
+		const auto& view = reg.view<ParticleComponent, ColorComponent>();
 
 		for(auto entity : view) {
 			auto& p = view.get<ParticleComponent>(entity);
-			auto& s = view.get<Shape>(entity);
+			auto& c = view.get<ColorComponent>(entity);
 
 			p.lifespan -= fElapsedTime;
 
@@ -21,7 +21,7 @@ struct ParticleSystem : public System {
 				reg.destroy(entity);
 			} else if (p.lifespan <= p.fade_begin) {
 				float alpha = 1.0f - ((p.fade_begin - p.lifespan) / p.fade_begin);
-				s.color.a = static_cast<uint8_t>(255 * alpha);
+				c.color.a = static_cast<uint8_t>(255 * alpha);
 			}
 		}
 	}
@@ -5,8 +5,13 @@
 
 #include "utilities/entt.hpp"
 
+#include <cmath>
+
 struct PhysicsSystem : public System {
-	PhysicsSystem(entt::registry& reg, olc::PixelGameEngine* pge) : System(reg, pge) {};
+	// step is the fixed simulation time step.  Damping is scaled to the step and bullets are swept along their
+	// path, so it can be raised on slow hardware without changing how the game plays
+	PhysicsSystem(entt::registry& reg, olc::PixelGameEngine* pge, float step = 1.0f / 60.0f) : System(reg, pge), dt(step),
+		steps(step * reference_rate), thrust_decay(std::pow(0.8f, steps)), coast_decay(std::pow(0.4f, steps)) {};
 
 	void PreUpdate() override {
 		const auto& view = reg.view<PhysicsComponent>();
@@ -27,7 +32,7 @@ struct PhysicsSystem : public System {
 
 	void OnUserUpdate(float fElapsedTime) override {
 		const auto& view = reg.view<PhysicsComponent, Shape>();
-		const float dt = 1.0f / 60.0f;
+		const auto& projectile_view = reg.view<PhysicsComponent, Projectile>();
 		total_time += fElapsedTime;
 
 		while(total_time > dt) {
@@ -36,36 +41,80 @@ struct PhysicsSystem : public System {
 				auto& physics = view.get<PhysicsComponent>(entity);
 				auto& shape = view.get<Shape>(entity);
 
-				if(physics.force.mag2() > 0) {
-					physics.acceleration *=  0.8f;
-					physics.velocity *= physics.friction;
-				} else {
-					physics.acceleration *=  0.4f;
-					physics.velocity *= physics.friction * physics.friction;
-				}
-	// 			if(physics.force.mag2() > 0) {
-	// 				physics.acceleration -=  (24.0f * physics.acceleration * fElapsedTime);
-	// 				physics.velocity = physics.velocity - 30.0f * physics.velocity * (1.0f - physics.friction) * fElapsedTime;
-	// 				//physics.velocity *= physics.friction;
-	// 			} else {
-	// 				physics.acceleration -=  (12.0f * physics.acceleration * fElapsedTime);
-	// 				physics.velocity -= 30.0f * physics.velocity * (1.0f - physics.friction * physics.friction) * fElapsedTime;
-	// //				physics.velocity *= (physics.friction * physics.velocity);
-	// 			}
-	
-				physics.acceleration += (physics.force / physics.mass) * dt;
-				physics.velocity += physics.acceleration * dt;
+				Integrate(physics);
 	
-				shape.theta += physics.angular_velocity * dt;
+				// Only the transform changes here, the TransformSystem builds the world geometry once per tick
+				if(physics.angular_velocity != 0.0f) {
+					shape.Rotate(physics.angular_velocity * dt, AngularStep(physics));
+				}
 	
 				shape.MoveTo(shape.position + physics.velocity * dt);
 				physics.force = {0.0f, 0.0f};
 
 			}
+
+			// Projectiles have no world geometry at all
+			for(auto entity : projectile_view) {
+				auto& physics = projectile_view.get<PhysicsComponent>(entity);
+				auto& projectile = projectile_view.get<Projectile>(entity);
+
+				Integrate(physics);
+
+				projectile.theta += physics.angular_velocity * dt;
+				projectile.position += physics.velocity * dt;
+				physics.force = {0.0f, 0.0f};
+			}
 		}
 
 
 	}
 
 	float total_time {0.0f};
+	float dt;
+
+private:
+	// Damping factors are tuned per step at this rate
+	static constexpr float reference_rate {60.0f};
+	// Reference steps in one step, and the acceleration decay over one step with and without a force applied
+	float steps;
+	float thrust_decay;
+	float coast_decay;
+
+	// factor applied once per reference step, over one step
+	float Damping(float factor) const {
+		return (steps == 1.0f) ? factor : std::pow(factor, steps);
+	}
+
+	// {sin, cos} of the turn over one step.  Only recomputed when the angular velocity changes
+	olc::vf2d AngularStep(PhysicsComponent& physics) const {
+		if(physics.angular_velocity != physics.angular_step_velocity) {
+			const float angle = physics.angular_velocity * dt;
+			physics.angular_step = {std::sinf(angle), std::cosf(angle)};
+			physics.angular_step_velocity = physics.angular_velocity;
+		}
+		return physics.angular_step;
+	}
+
+	// Apply friction and the accumulated force to the velocity for one step
+	void Integrate(PhysicsComponent& physics) const {
+		if(physics.force.mag2() > 0) {
+			physics.acceleration *=  thrust_decay;
+			physics.velocity *= Damping(physics.friction);
+		} else {
+			physics.acceleration *=  coast_decay;
+			physics.velocity *= Damping(physics.friction * physics.friction);
+		}
+	// 	if(physics.force.mag2() > 0) {
+	// 		physics.acceleration -=  (24.0f * physics.acceleration * fElapsedTime);
+	// 		physics.velocity = physics.velocity - 30.0f * physics.velocity * (1.0f - physics.friction) * fElapsedTime;
+	// 		//physics.velocity *= physics.friction;
+	// 	} else {
+	// 		physics.acceleration -=  (12.0f * physics.acceleration * fElapsedTime);
+	// 		physics.velocity -= 30.0f * physics.velocity * (1.0f - physics.friction * physics.friction) * fElapsedTime;
+	// //		physics.velocity *= (physics.friction * physics.velocity);
+	// 	}
+
+		physics.acceleration += (physics.force / physics.mass) * dt;
+		physics.velocity += physics.acceleration * dt;
+	}
 };
\ No newline at end of file
@@ -3,19 +3,40 @@
 #include "components.hpp"
 #include "system.hpp"
 
+// Weapons are children of the player's weapon mount points, weapon i sits on mount i.  Their world
+// positions are derived from the player transform in one pass after physics, and only when the player
+// moved, turned, grew, changed prototype or gained a weapon since the last pass
 struct PlayerWeaponSystem : public System {
 	PlayerWeaponSystem(entt::entity player, entt::registry& reg, olc::PixelGameEngine* pge) : player_entity(player), System(reg, pge) {};
 
 	void OnUserUpdate(float fElapsedTime) override {
 		auto& p = reg.get<PlayerComponent>(player_entity);
-		auto& s = reg.get<Shape>(player_entity);
-		const auto& wp = s.WeaponPoints();
+		const auto& s = reg.get<Shape>(player_entity);
 
-		for(int i = 0; i < p.weapons.size(); i++) {
-			p.weapons[i].SetPosition(wp[i]);
-			p.weapons[i].OnUserUpdate(fElapsedTime);
+		const ParentTransform parent {s.position, s.Theta(), s.scale, s.GetPrototype().type, p.weapons.size()};
+		if(parent != mounted) {
+			mounted = parent;
+			for(size_t i = 0; i < p.weapons.size(); i++) {
+				p.weapons[i].SetPosition(s.WeaponPoint(i));
+			}
+		}
+
+		for(auto& w : p.weapons) {
+			w.OnUserUpdate(fElapsedTime);
 		}
 	}
 private:
+	// Everything the children's world positions depend on
+	struct ParentTransform {
+		olc::vf2d position {};
+		float theta {0.0f};
+		float scale {0.0f};
+		ShapePrototypes type {ShapePrototypes::Count};
+		size_t child_count {0};
+
+		bool operator==(const ParentTransform&) const = default;
+	};
+
 	entt::entity player_entity;
-};
\ No newline at end of file
+	ParentTransform mounted;
+};
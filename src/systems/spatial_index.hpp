@@ -0,0 +1,38 @@
+#pragma once
+
+#include "components.hpp"
+#include "shape.hpp"
+#include "system.hpp"
+
+#include "utilities/entt.hpp"
+#include "utilities/quad_tree.hpp"
+
+// Loose quadtree over the bounds of every collider Shape, stored in the registry context.  Particles are left out
+using SpatialIndex = utilities::QuadTree<entt::entity>;
+
+// Keeps the SpatialIndex in sync with the shapes.  Run after anything that moves shapes
+struct SpatialIndexSystem : public System {
+	SpatialIndexSystem(entt::registry& reg, olc::PixelGameEngine* pge) : System(reg, pge) {
+		// Enemies spawn and bosses park well outside the screen, so cover a few screens around it
+		const olc::vf2d screen = pge->GetScreenSize();
+		reg.ctx().emplace<SpatialIndex>(olc::utils::geom2d::rect<float>{screen * -2.0f, screen * 5.0f});
+		reg.on_destroy<Shape>().connect<&SpatialIndexSystem::on_shape_destroyed>(this);
+	};
+
+	~SpatialIndexSystem() {
+		reg.on_destroy<Shape>().disconnect(this);
+	}
+
+	void on_shape_destroyed(entt::registry& registry, entt::entity entity) {
+		registry.ctx().get<SpatialIndex>().Remove(entity);
+	}
+
+	void OnUserUpdate(float fElapsedTime) override {
+		auto& index = reg.ctx().get<SpatialIndex>();
+		const auto view = reg.view<ColliderComponent, Shape>();
+
+		for(auto entity : view) {
+			index.Update(entity, view.get<Shape>(entity).Bounds());
+		}
+	}
+};
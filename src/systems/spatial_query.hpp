@@ -0,0 +1,114 @@
+#pragma once
+
+#include "components.hpp"
+#include "shape.hpp"
+
+#include "systems/spatial_index.hpp"
+
+#include "utilities/entt.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Targeting queries over the SpatialIndex, stored in the registry context.  Distances are measured to the
+// center of each collider's bounds, except InRadius which measures to the nearest point of the bounds.
+// Only colliders on the requested layer are returned.
+// Results are written to out, which is cleared first, so callers can reuse the same vector every frame
+class SpatialQuery {
+public:
+	explicit SpatialQuery(const entt::registry& reg) : reg(reg) {}
+
+	// Up to count colliders closest to position, nearest first
+	void Nearest(olc::vf2d position, size_t count, std::vector<entt::entity>& out, CollisionLayer layer = CollisionLayer::Enemy, float max_distance = std::numeric_limits<float>::max()) const {
+		out.clear();
+		if(count == 0) {
+			return;
+		}
+
+		// Grow the search circle until it holds enough colliders.  Anything outside it is further than
+		// everything inside, so the nearest count inside are the nearest overall
+		const auto& index = reg.ctx().get<SpatialIndex>();
+		float radius = std::min(initial_radius, max_distance);
+		while(true) {
+			Collect(index, position, radius, layer);
+			if(scratch.size() >= count || radius >= max_distance) {
+				break;
+			}
+
+			// A few screens out there are too few colliders left to bother growing slowly
+			radius = (radius >= full_radius) ? max_distance : std::min(radius * 2.0f, max_distance);
+		}
+
+		const size_t n = std::min(count, scratch.size());
+		std::partial_sort(scratch.begin(), scratch.begin() + n, scratch.end());
+		for(size_t i = 0; i < n; i++) {
+			out.push_back(scratch[i].second);
+		}
+	}
+
+	// Closest collider to position, or entt::null when there is none within max_distance
+	entt::entity Nearest(olc::vf2d position, CollisionLayer layer = CollisionLayer::Enemy, float max_distance = std::numeric_limits<float>::max()) const {
+		Nearest(position, 1, single, layer, max_distance);
+		return single.empty() ? entt::null : single.front();
+	}
+
+	// Every collider whose bounds come within radius of center, in no particular order.  Large shapes like
+	// bosses are caught by their outline, not only when their center is in range
+	void InRadius(olc::vf2d center, float radius, std::vector<entt::entity>& out, CollisionLayer layer = CollisionLayer::Enemy) const {
+		out.clear();
+		reg.ctx().get<SpatialIndex>().ForEachInRect({center - olc::vf2d{radius, radius}, olc::vf2d{radius, radius} * 2.0f}, [&](entt::entity entity, const SpatialIndex::rect& bounds) {
+			const olc::vf2d closest = center.max(bounds.pos).min(bounds.pos + bounds.size);
+			if((closest - center).mag2() <= radius * radius && OnLayer(entity, layer)) {
+				out.push_back(entity);
+			}
+		});
+	}
+
+	// Every collider within range of apex and less than half_angle radians away from direction, in no particular order
+	void InCone(olc::vf2d apex, olc::vf2d direction, float half_angle, float range, std::vector<entt::entity>& out, CollisionLayer layer = CollisionLayer::Enemy) const {
+		out.clear();
+		const olc::vf2d axis = direction.norm();
+		const float cos_half = std::cos(half_angle);
+
+		reg.ctx().get<SpatialIndex>().ForEachInRect({apex - olc::vf2d{range, range}, olc::vf2d{range, range} * 2.0f}, [&](entt::entity entity, const SpatialIndex::rect& bounds) {
+			const olc::vf2d offset = bounds.middle() - apex;
+			const float distance2 = offset.mag2();
+			if(distance2 > range * range || !OnLayer(entity, layer)) {
+				return;
+			}
+
+			if(distance2 == 0.0f || axis.dot(offset) >= cos_half * std::sqrt(distance2)) {
+				out.push_back(entity);
+			}
+		});
+	}
+
+private:
+	bool OnLayer(entt::entity entity, CollisionLayer layer) const {
+		const auto* collider = reg.try_get<ColliderComponent>(entity);
+		return collider && collider->layer == layer;
+	}
+
+	// Fill scratch with (squared distance, entity) of every collider on layer within radius of center
+	void Collect(const SpatialIndex& index, olc::vf2d center, float radius, CollisionLayer layer) const {
+		scratch.clear();
+		index.ForEachInRect({center - olc::vf2d{radius, radius}, olc::vf2d{radius, radius} * 2.0f}, [&](entt::entity entity, const SpatialIndex::rect& bounds) {
+			const float distance2 = (bounds.middle() - center).mag2();
+			if(distance2 <= radius * radius && OnLayer(entity, layer)) {
+				scratch.emplace_back(distance2, entity);
+			}
+		});
+	}
+
+	// First search radius of Nearest, about the spacing of a normal horde
+	static constexpr float initial_radius {64.0f};
+	// Search radius after which Nearest takes everything within max_distance
+	static constexpr float full_radius {4096.0f};
+
+	const entt::registry& reg;
+	mutable std::vector<std::pair<float, entt::entity>> scratch;
+	mutable std::vector<entt::entity> single;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "shape.hpp"
+#include "system.hpp"
+#include "world_geometry.hpp"
+
+#include "utilities/entt.hpp"
+
+// Transforms every shape with a collider into the WorldGeometry buffer once per tick.  Run after anything that moves
+// shapes and before the CollisionSystem, which only reads the buffer
+struct TransformSystem : public System {
+	TransformSystem(entt::registry& reg, olc::PixelGameEngine* pge) : System(reg, pge) {
+		reg.ctx().emplace<WorldGeometry>();
+	};
+
+	void OnUserUpdate(float fElapsedTime) override {
+		reg.ctx().get<WorldGeometry>().Build(reg);
+	}
+};
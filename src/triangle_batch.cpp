@@ -0,0 +1,120 @@
+#include "triangle_batch.hpp"
+#include "simd_lanes.hpp"
+
+#include <algorithm>
+
+namespace {
+    using simd::ScalarLanes;
+    using simd::SimdLanes;
+
+    // Separating axis test of triangle t against the batch triangles starting at i.
+    // Returns a bit mask of the lanes that overlap t
+    template<typename L>
+    int OverlapLanes(const olc::utils::geom2d::triangle<float>& t, const float* x0, const float* y0, const float* x1, const float* y1, const float* x2, const float* y2) {
+        using V = typename L::type;
+        const V bx[3] = {L::load(x0), L::load(x1), L::load(x2)};
+        const V by[3] = {L::load(y0), L::load(y1), L::load(y2)};
+        int separated = 0;
+
+        // Axes from the edges of t, its own interval is the same for every lane
+        for(int e = 0; e < 3; e++) {
+            const olc::vf2d edge = t.pos[(e + 1) % 3] - t.pos[e];
+            const olc::vf2d n {edge.y, -edge.x};
+            const float d0 = n.dot(t.pos[0]);
+            const float d1 = n.dot(t.pos[1]);
+            const float d2 = n.dot(t.pos[2]);
+            const V t_min = L::set1(std::min({d0, d1, d2}));
+            const V t_max = L::set1(std::max({d0, d1, d2}));
+
+            const V nx = L::set1(n.x);
+            const V ny = L::set1(n.y);
+            const V p0 = L::add(L::mul(bx[0], nx), L::mul(by[0], ny));
+            const V p1 = L::add(L::mul(bx[1], nx), L::mul(by[1], ny));
+            const V p2 = L::add(L::mul(bx[2], nx), L::mul(by[2], ny));
+            const V b_min = L::min(p0, L::min(p1, p2));
+            const V b_max = L::max(p0, L::max(p1, p2));
+
+            separated |= L::less(b_max, t_min) | L::less(t_max, b_min);
+        }
+
+        // Axes from the edges of the batch triangles, one per lane
+        const V tx[3] = {L::set1(t.pos[0].x), L::set1(t.pos[1].x), L::set1(t.pos[2].x)};
+        const V ty[3] = {L::set1(t.pos[0].y), L::set1(t.pos[1].y), L::set1(t.pos[2].y)};
+        for(int e = 0; e < 3; e++) {
+            const V nx = L::sub(by[(e + 1) % 3], by[e]);
+            const V ny = L::sub(bx[e], bx[(e + 1) % 3]);
+
+            const V p0 = L::add(L::mul(bx[0], nx), L::mul(by[0], ny));
+            const V p1 = L::add(L::mul(bx[1], nx), L::mul(by[1], ny));
+            const V p2 = L::add(L::mul(bx[2], nx), L::mul(by[2], ny));
+            const V b_min = L::min(p0, L::min(p1, p2));
+            const V b_max = L::max(p0, L::max(p1, p2));
+
+            const V q0 = L::add(L::mul(tx[0], nx), L::mul(ty[0], ny));
+            const V q1 = L::add(L::mul(tx[1], nx), L::mul(ty[1], ny));
+            const V q2 = L::add(L::mul(tx[2], nx), L::mul(ty[2], ny));
+            const V t_min = L::min(q0, L::min(q1, q2));
+            const V t_max = L::max(q0, L::max(q1, q2));
+
+            separated |= L::less(b_max, t_min) | L::less(t_max, b_min);
+        }
+
+        return ~separated & ((1 << L::width) - 1);
+    }
+}
+
+void TriangleBatch::Clear() {
+    x0.clear();
+    y0.clear();
+    x1.clear();
+    y1.clear();
+    x2.clear();
+    y2.clear();
+    owners.clear();
+    owner_count = 0;
+}
+
+size_t TriangleBatch::Add(const ShapeGeometry& shape) {
+    for(size_t i = 0; i < shape.TriangleCount(); i++) {
+        const auto t = shape.Triangle(i);
+        x0.push_back(t.pos[0].x);
+        y0.push_back(t.pos[0].y);
+        x1.push_back(t.pos[1].x);
+        y1.push_back(t.pos[1].y);
+        x2.push_back(t.pos[2].x);
+        y2.push_back(t.pos[2].y);
+        owners.push_back(owner_count);
+    }
+
+    return owner_count++;
+}
+
+size_t TriangleBatch::OwnerCount() const {
+    return owner_count;
+}
+
+void TriangleBatch::Overlaps(const ShapeGeometry& shape, std::vector<uint8_t>& hits) const {
+    hits.assign(owner_count, 0);
+    lane_hits.assign(owners.size(), 0);
+
+    const size_t count = owners.size();
+    const size_t simd_count = count - (count % SimdLanes::width);
+
+    for(size_t n = 0; n < shape.TriangleCount(); n++) {
+        const auto t = shape.Triangle(n);
+        size_t i = 0;
+        for(; i < simd_count; i += SimdLanes::width) {
+            const int mask = OverlapLanes<SimdLanes>(t, &x0[i], &y0[i], &x1[i], &y1[i], &x2[i], &y2[i]);
+            for(size_t lane = 0; lane < SimdLanes::width; lane++) {
+                lane_hits[i + lane] |= (mask >> lane) & 1;
+            }
+        }
+        for(; i < count; i++) {
+            lane_hits[i] |= OverlapLanes<ScalarLanes>(t, &x0[i], &y0[i], &x1[i], &y1[i], &x2[i], &y2[i]);
+        }
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        hits[owners[i]] |= lane_hits[i];
+    }
+}
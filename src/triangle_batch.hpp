@@ -0,0 +1,29 @@
+#pragma once
+
+#include "world_geometry.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Structure of arrays copy of the world triangles of several shapes, so one triangle can be
+// tested against 4 (SSE2) or 8 (AVX2) of them at once.  Falls back to scalar code when neither is available.
+class TriangleBatch {
+public:
+	void Clear();
+
+	// Append every world triangle of shape.  Returns the owner index used by Overlaps
+	size_t Add(const ShapeGeometry& shape);
+
+	// Number of shapes added since the last Clear
+	size_t OwnerCount() const;
+
+	// Set hits[owner] to 1 for every added shape that overlaps shape.  hits is resized to OwnerCount()
+	void Overlaps(const ShapeGeometry& shape, std::vector<uint8_t>& hits) const;
+
+private:
+	std::vector<float> x0, y0, x1, y1, x2, y2;
+	std::vector<uint32_t> owners;
+	uint32_t owner_count {0};
+	// Per triangle result of a single query, reused between calls
+	mutable std::vector<uint8_t> lane_hits;
+};
@@ -0,0 +1,41 @@
+#include "triangle_list.hpp"
+
+void TriangleList::Add(olc::vf2d a, olc::vf2d b, olc::vf2d c, olc::Pixel color) {
+    // Flat triangles ignore their texture coordinates
+    Add(a, b, c, {}, {}, {}, color);
+}
+
+void TriangleList::Add(olc::vf2d a, olc::vf2d b, olc::vf2d c, olc::vf2d uv_a, olc::vf2d uv_b, olc::vf2d uv_c, olc::Pixel color) {
+    if(used == 0 || chunks[used - 1].vertices.size() + 3 > max_vertices) {
+        if(used == chunks.size()) {
+            auto& chunk = chunks.emplace_back();
+            chunk.vertices.reserve(max_vertices);
+            chunk.uvs.reserve(max_vertices);
+            chunk.colors.reserve(max_vertices);
+        }
+        used++;
+    }
+
+    auto& chunk = chunks[used - 1];
+    chunk.vertices.insert(chunk.vertices.end(), {a, b, c});
+    chunk.uvs.insert(chunk.uvs.end(), {uv_a, uv_b, uv_c});
+    chunk.colors.insert(chunk.colors.end(), {color, color, color});
+}
+
+size_t TriangleList::Submit(olc::PixelGameEngine* pge) {
+    const size_t submitted = used;
+    if(used > 0) {
+        // Every three vertices are a separate triangle
+        pge->SetDecalStructure(olc::DecalStructure::LIST);
+        for(size_t i = 0; i < used; i++) {
+            pge->DrawPolygonDecal(decal, chunks[i].vertices, chunks[i].uvs, chunks[i].colors);
+            chunks[i].vertices.clear();
+            chunks[i].uvs.clear();
+            chunks[i].colors.clear();
+        }
+        pge->SetDecalStructure(olc::DecalStructure::FAN);
+    }
+
+    used = 0;
+    return submitted;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "olcPixelGameEngine.h"
+
+#include <vector>
+
+// Filled triangles collected over a frame and handed to the PGE as a few triangle list polygon decals,
+// instead of one FillTriangleDecal per triangle.  Storage is kept between frames so steady frames don't allocate
+class TriangleList {
+public:
+	// Triangles are textured from decal, or filled flat when it is null
+	explicit TriangleList(olc::Decal* decal = nullptr) : decal(decal) {}
+
+	void Add(olc::vf2d a, olc::vf2d b, olc::vf2d c, olc::Pixel color);
+
+	// Textured triangle, uv_a to uv_c are the texture coordinates of a to c
+	void Add(olc::vf2d a, olc::vf2d b, olc::vf2d c, olc::vf2d uv_a, olc::vf2d uv_b, olc::vf2d uv_c, olc::Pixel color);
+
+	// Draw and clear every triangle added since the last Submit.  Returns the number of decals submitted
+	size_t Submit(olc::PixelGameEngine* pge);
+
+private:
+	// The OpenGL 3.3 renderer, used by the web build, streams at most 128 vertices per decal
+	static constexpr size_t max_vertices = 126;
+
+	struct Chunk {
+		std::vector<olc::vf2d> vertices;
+		std::vector<olc::vf2d> uvs;
+		std::vector<olc::Pixel> colors;
+	};
+
+	olc::Decal* decal;
+	std::vector<Chunk> chunks;
+	// Chunks holding triangles this frame
+	size_t used {0};
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utilities
+{
+    /// @brief Small persistent pool of worker threads for splitting a loop across cores.
+    /// The calling thread works alongside the workers.  Builds without thread support (Emscripten without
+    /// pthreads) run everything on the calling thread
+    class ParallelFor {
+    public:
+        /// @param thread_count Threads to use including the caller.  0 picks one per hardware thread
+        explicit ParallelFor(unsigned thread_count = 0) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+            thread_count = 1;
+#endif
+            if(thread_count == 0) {
+                thread_count = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            for(unsigned i = 1; i < thread_count; i++) {
+                workers.emplace_back([this, i] { Work(i); });
+            }
+        }
+
+        ~ParallelFor() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for(auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        ParallelFor(const ParallelFor&) = delete;
+        ParallelFor& operator=(const ParallelFor&) = delete;
+
+        /// @brief Threads used by Run, including the caller
+        size_t ThreadCount() const {
+            return workers.size() + 1;
+        }
+
+        /// @brief Call func(index, thread) for every index in [0, count) and wait for all of them.
+        /// Indices are handed out in order but may finish in any order.  thread is below ThreadCount(), so it can pick per-thread scratch
+        template<typename F>
+        void Run(size_t count, F&& func) {
+            if(workers.empty() || count <= 1) {
+                for(size_t i = 0; i < count; i++) {
+                    func(i, size_t{0});
+                }
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = [&func](size_t index, size_t thread) { func(index, thread); };
+                job_count = count;
+                next = 0;
+                busy = workers.size();
+                generation++;
+            }
+            wake.notify_all();
+
+            Drain(0);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return busy == 0; });
+            job = nullptr;
+        }
+
+    private:
+        void Drain(size_t thread) {
+            for(size_t i = next.fetch_add(1); i < job_count; i = next.fetch_add(1)) {
+                job(i, thread);
+            }
+        }
+
+        void Work(size_t thread) {
+            uint64_t seen = 0;
+            while(true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stopping || generation != seen; });
+                    if(stopping) {
+                        return;
+                    }
+                    seen = generation;
+                }
+
+                Drain(thread);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if(--busy == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+
+        // Current job, only touched under the mutex except while it runs
+        std::function<void(size_t, size_t)> job;
+        std::atomic<size_t> next {0};
+        size_t job_count {0};
+        size_t busy {0};
+        uint64_t generation {0};
+        bool stopping {false};
+    };
+}
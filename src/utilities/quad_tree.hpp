@@ -0,0 +1,219 @@
+#pragma once
+
+#include "utilities/olcUTIL_Geometry2D.h"
+#include "olcPixelGameEngine.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace utilities
+{
+    /// @brief Loose quadtree.  Every node's loose bounds are twice its size, so a value lives in the single
+    /// node that contains its center at the depth matching its size.  Big values (bosses) sit near the root and
+    /// small ones (bullets) deep down, and moving a value only relinks it when it leaves its node.
+    /// @tparam T Stored value, typically an entt::entity.  Must be hashable
+    template<typename T>
+    class QuadTree {
+    public:
+        using rect = olc::utils::geom2d::rect<float>;
+
+        /// @param area Region covered by the tree.  Values outside of it are kept in a list every query checks
+        /// @param max_depth Deepest level nodes are created at
+        explicit QuadTree(const rect& area, int max_depth = 8) : max_depth(max_depth) {
+            // Square root node so that every level halves evenly
+            const float size = std::max(area.size.x, area.size.y);
+            nodes.push_back(Node{{area.middle() - olc::vf2d{size, size} * 0.5f, {size, size}}});
+        }
+
+        void Insert(const T& value, const rect& bounds) {
+            const uint32_t node = FindNode(bounds);
+            auto& items = Items(node);
+            locations[value] = {node, static_cast<uint32_t>(items.size())};
+            items.push_back({value, bounds});
+        }
+
+        /// @brief Move value to new bounds, inserting it if it isn't in the tree yet
+        void Update(const T& value, const rect& bounds) {
+            const auto itr = locations.find(value);
+            if(itr == locations.end()) {
+                Insert(value, bounds);
+                return;
+            }
+
+            // Still inside the loose bounds of its node, only the stored bounds change
+            const uint32_t node = FindNode(bounds);
+            if(node == itr->second.node) {
+                Items(node)[itr->second.slot].bounds = bounds;
+                return;
+            }
+
+            Unlink(itr->second);
+            const auto& items = Items(node);
+            itr->second = {node, static_cast<uint32_t>(items.size())};
+            Items(node).push_back({value, bounds});
+        }
+
+        void Remove(const T& value) {
+            const auto itr = locations.find(value);
+            if(itr == locations.end()) {
+                return;
+            }
+
+            Unlink(itr->second);
+            locations.erase(itr);
+        }
+
+        bool Contains(const T& value) const {
+            return locations.contains(value);
+        }
+
+        size_t Size() const {
+            return locations.size();
+        }
+
+        void Clear() {
+            nodes.resize(1);
+            nodes[0].children = {};
+            nodes[0].items.clear();
+            outside.clear();
+            locations.clear();
+        }
+
+        /// @brief Call func(value, bounds) for every value whose bounds overlap area.  func must not query the tree again
+        template<typename F>
+        void ForEachInRect(const rect& area, F&& func) const {
+            for(const auto& item : outside) {
+                if(Overlaps(item.bounds, area)) {
+                    func(item.value, item.bounds);
+                }
+            }
+
+            stack.clear();
+            stack.push_back(0);
+
+            while(!stack.empty()) {
+                const Node& node = nodes[stack.back()];
+                stack.pop_back();
+
+                // Loose bounds are the node grown by half its size on every side
+                const rect loose {node.bounds.pos - node.bounds.size * 0.5f, node.bounds.size * 2.0f};
+                if(!Overlaps(loose, area)) {
+                    continue;
+                }
+
+                for(const auto& item : node.items) {
+                    if(Overlaps(item.bounds, area)) {
+                        func(item.value, item.bounds);
+                    }
+                }
+
+                for(const auto child : node.children) {
+                    if(child != 0) {
+                        stack.push_back(child);
+                    }
+                }
+            }
+        }
+
+        /// @brief Collect every value whose bounds overlap area
+        void QueryRect(const rect& area, std::vector<T>& out) const {
+            out.clear();
+            ForEachInRect(area, [&](const T& value, const rect&) { out.push_back(value); });
+        }
+
+        /// @brief Collect every value whose bounds overlap the circle
+        void QueryCircle(olc::vf2d center, float radius, std::vector<T>& out) const {
+            out.clear();
+            const rect area {center - olc::vf2d{radius, radius}, olc::vf2d{radius, radius} * 2.0f};
+            ForEachInRect(area, [&](const T& value, const rect& bounds) {
+                // Closest point of the bounds to the circle center
+                const olc::vf2d closest = center.max(bounds.pos).min(bounds.pos + bounds.size);
+                if((closest - center).mag2() <= radius * radius) {
+                    out.push_back(value);
+                }
+            });
+        }
+
+    private:
+        struct Item {
+            T value;
+            rect bounds;
+        };
+
+        struct Node {
+            rect bounds;
+            // Index of each child in nodes, 0 when it doesn't exist yet
+            std::array<uint32_t, 4> children {};
+            std::vector<Item> items;
+        };
+
+        // Node index used for values that aren't inside the root
+        static constexpr uint32_t outside_node = UINT32_MAX;
+
+        struct Location {
+            uint32_t node;
+            uint32_t slot;
+        };
+
+        static bool Overlaps(const rect& a, const rect& b) {
+            return (a.pos.x <= b.pos.x + b.size.x) && (b.pos.x <= a.pos.x + a.size.x) &&
+                   (a.pos.y <= b.pos.y + b.size.y) && (b.pos.y <= a.pos.y + a.size.y);
+        }
+
+        std::vector<Item>& Items(uint32_t node) {
+            return (node == outside_node) ? outside : nodes[node].items;
+        }
+
+        // Find (creating on the way) the node a value with these bounds belongs to
+        uint32_t FindNode(const rect& bounds) {
+            const olc::vf2d center = bounds.middle();
+            const rect root = nodes[0].bounds;
+
+            if(center.x < root.pos.x || center.y < root.pos.y || center.x >= root.pos.x + root.size.x || center.y >= root.pos.y + root.size.y) {
+                return outside_node;
+            }
+
+            // Deepest level whose node size still covers the value
+            const float extent = std::max({bounds.size.x, bounds.size.y, 1e-3f});
+            const int depth = std::clamp(static_cast<int>(std::floor(std::log2(root.size.x / extent))), 0, max_depth);
+
+            uint32_t node = 0;
+            for(int d = 0; d < depth; d++) {
+                const olc::vf2d half = nodes[node].bounds.size * 0.5f;
+                const olc::vf2d mid = nodes[node].bounds.pos + half;
+                const int quadrant = ((center.x >= mid.x) ? 1 : 0) + ((center.y >= mid.y) ? 2 : 0);
+
+                if(nodes[node].children[quadrant] == 0) {
+                    const olc::vf2d pos {(quadrant & 1) ? mid.x : nodes[node].bounds.pos.x, (quadrant & 2) ? mid.y : nodes[node].bounds.pos.y};
+                    nodes[node].children[quadrant] = static_cast<uint32_t>(nodes.size());
+                    nodes.push_back(Node{{pos, half}});
+                }
+
+                node = nodes[node].children[quadrant];
+            }
+
+            return node;
+        }
+
+        // Swap-remove the item at location, fixing up the location of the item that moved into its slot
+        void Unlink(const Location& location) {
+            auto& items = Items(location.node);
+            if(location.slot + 1 != items.size()) {
+                items[location.slot] = items.back();
+                locations[items[location.slot].value].slot = location.slot;
+            }
+            items.pop_back();
+        }
+
+        int max_depth;
+        std::vector<Node> nodes;
+        std::vector<Item> outside;
+        std::unordered_map<T, Location> locations;
+        // Traversal stack reused between queries
+        mutable std::vector<uint32_t> stack;
+    };
+}
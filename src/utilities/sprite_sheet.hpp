@@ -0,0 +1,85 @@
+#pragma once
+
+#include "olcPixelGameEngine.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace utilities
+{
+    /// @brief Packs rectangular regions into one olc::Sprite that is uploaded as a single Decal, so everything drawn
+    /// from it shares a texture.  Regions are placed left to right on shelves as tall as their tallest region.
+    class SpriteSheet {
+    public:
+        /// @brief Area of the sheet in pixels
+        struct Region {
+            olc::vi2d position;
+            olc::vi2d size;
+        };
+
+        /// @param width Width of the sheet in pixels
+        /// @param height Height of the sheet in pixels
+        /// @param clear Colour every pixel starts as.  Keep the colour of transparent pixels close to the drawn ones
+        /// so filtering doesn't bleed a dark fringe around them
+        SpriteSheet(int32_t width, int32_t height, olc::Pixel clear = olc::Pixel(255, 255, 255, 0)) : sprite(std::make_unique<olc::Sprite>(width, height)) {
+            for(int32_t y = 0; y < height; y++) {
+                for(int32_t x = 0; x < width; x++) {
+                    sprite->SetPixel(x, y, clear);
+                }
+            }
+        }
+
+        /// @brief Reserve a region of the sheet, kept padding pixels away from every other region
+        /// @return The region, or nothing when the sheet is full
+        std::optional<Region> Allocate(olc::vi2d size, int32_t padding = 1) {
+            const olc::vi2d padded = size + olc::vi2d{padding, padding} * 2;
+            if(cursor.x + padded.x > sprite->width) {
+                // Start a new shelf
+                cursor = {0, cursor.y + shelf_height};
+                shelf_height = 0;
+            }
+            if(padded.x > sprite->width || cursor.y + padded.y > sprite->height) {
+                return std::nullopt;
+            }
+
+            const Region region {cursor + olc::vi2d{padding, padding}, size};
+            cursor.x += padded.x;
+            shelf_height = std::max(shelf_height, padded.y);
+            return region;
+        }
+
+        /// @brief Sprite to write the pixels of the regions to
+        olc::Sprite* GetSprite() const {
+            return sprite.get();
+        }
+
+        /// @brief Upload the sprite to the GPU.  Call once the pixels are written and again whenever they change
+        /// @param filter Sample the decal with linear filtering, for drawing regions scaled
+        void Upload(bool filter = true) {
+            if(decal) {
+                decal->Update();
+            } else {
+                decal = std::make_unique<olc::Decal>(sprite.get(), filter);
+            }
+        }
+
+        /// @brief The uploaded decal, null until Upload is called
+        olc::Decal* GetDecal() const {
+            return decal.get();
+        }
+
+        /// @brief Normalised texture coordinates of a point on the sheet
+        olc::vf2d UV(olc::vf2d p) const {
+            return p / olc::vf2d{static_cast<float>(sprite->width), static_cast<float>(sprite->height)};
+        }
+
+    private:
+        std::unique_ptr<olc::Sprite> sprite;
+        std::unique_ptr<olc::Decal> decal;
+        // Top left corner of the next region and height of the current shelf
+        olc::vi2d cursor {0, 0};
+        int32_t shelf_height {0};
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace utilities
+{
+    /// @brief Vector with a fixed capacity stored inline, so creating, copying and filling it never allocates.
+    /// Only the subset of std::vector the shapes need.
+    /// @tparam T Element type, must be default constructible
+    /// @tparam N Capacity
+    template<typename T, size_t N>
+    class StaticVector {
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        void push_back(const T& value) {
+            assert(count < N && "StaticVector capacity exceeded");
+            items[count++] = value;
+        }
+
+        void clear() {
+            count = 0;
+        }
+
+        size_t size() const {
+            return count;
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        static constexpr size_t capacity() {
+            return N;
+        }
+
+        T* data() {
+            return items.data();
+        }
+
+        const T* data() const {
+            return items.data();
+        }
+
+        T& operator[](size_t i) {
+            return items[i];
+        }
+
+        const T& operator[](size_t i) const {
+            return items[i];
+        }
+
+        iterator begin() {
+            return items.data();
+        }
+
+        iterator end() {
+            return items.data() + count;
+        }
+
+        const_iterator begin() const {
+            return items.data();
+        }
+
+        const_iterator end() const {
+            return items.data() + count;
+        }
+
+    private:
+        std::array<T, N> items {};
+        size_t count {0};
+    };
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "utilities/olcUTIL_Geometry2D.h"
+#include "olcPixelGameEngine.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace utilities
+{
+    /// @brief Sweep and prune broadphase with a persistent set of overlapping pairs.
+    /// Endpoints stay sorted on both axes between ticks and are re-sorted with an insertion sort.  Because things
+    /// move a little per tick only a few endpoints swap, and every swap adds or removes a pair in the cache.
+    /// @tparam T Stored value, typically an entt::entity.  Must be hashable
+    template<typename T>
+    class SweepAndPrune {
+    public:
+        using rect = olc::utils::geom2d::rect<float>;
+
+        /// @brief Set the bounds of value, adding it if it isn't known yet.  Takes effect on the next Sort()
+        void Update(const T& value, const rect& bounds) {
+            const auto itr = ids.find(value);
+            if(itr != ids.end()) {
+                proxies[itr->second].bounds = bounds;
+                return;
+            }
+
+            uint32_t id;
+            if(free_ids.empty()) {
+                id = static_cast<uint32_t>(proxies.size());
+                proxies.push_back({});
+            } else {
+                id = free_ids.back();
+                free_ids.pop_back();
+            }
+
+            proxies[id] = {value, bounds, true};
+            ids[value] = id;
+            added.push_back(id);
+        }
+
+        /// @brief Forget value.  Its pairs are dropped on the next Sort()
+        void Remove(const T& value) {
+            const auto itr = ids.find(value);
+            if(itr == ids.end()) {
+                return;
+            }
+
+            proxies[itr->second].alive = false;
+            removed.push_back(itr->second);
+            ids.erase(itr);
+        }
+
+        /// @brief Bring the sorted axes and the pair cache up to date with every Update and Remove since the last call
+        void Sort() {
+            if(!removed.empty()) {
+                DropRemoved();
+            }
+
+            for(auto* axis : {&axis_x, &axis_y}) {
+                const bool x = (axis == &axis_x);
+
+                // Refresh the values of the existing endpoints, keeping last tick's order
+                for(auto& e : *axis) {
+                    const rect& b = proxies[e.proxy].bounds;
+                    e.value = x ? (e.is_max ? b.pos.x + b.size.x : b.pos.x) : (e.is_max ? b.pos.y + b.size.y : b.pos.y);
+                }
+
+                // New proxies start out past the end of the axis, overlapping nothing
+                for(const auto id : added) {
+                    const rect& b = proxies[id].bounds;
+                    axis->push_back({x ? b.pos.x : b.pos.y, id, false});
+                    axis->push_back({x ? b.pos.x + b.size.x : b.pos.y + b.size.y, id, true});
+                }
+
+                InsertionSort(*axis);
+            }
+
+            added.clear();
+        }
+
+        /// @brief Every pair of values whose bounds overlapped at the last Sort().  Values removed since then may still appear
+        const std::vector<std::pair<T, T>>& Pairs() const {
+            return pairs;
+        }
+
+    private:
+        struct Proxy {
+            T value {};
+            rect bounds {};
+            bool alive {false};
+        };
+
+        struct Endpoint {
+            float value;
+            uint32_t proxy;
+            bool is_max;
+        };
+
+        static uint64_t Key(uint32_t a, uint32_t b) {
+            return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+        }
+
+        bool Overlaps(uint32_t a, uint32_t b) const {
+            const rect& r1 = proxies[a].bounds;
+            const rect& r2 = proxies[b].bounds;
+            return (r1.pos.x <= r2.pos.x + r2.size.x) && (r2.pos.x <= r1.pos.x + r1.size.x) &&
+                   (r1.pos.y <= r2.pos.y + r2.size.y) && (r2.pos.y <= r1.pos.y + r1.size.y);
+        }
+
+        void AddPair(uint32_t a, uint32_t b) {
+            const uint64_t key = Key(a, b);
+            if(pair_index.contains(key)) {
+                return;
+            }
+
+            pair_index[key] = pairs.size();
+            pair_ids.push_back(key);
+            pairs.push_back({proxies[a].value, proxies[b].value});
+        }
+
+        void RemovePair(uint32_t a, uint32_t b) {
+            const auto itr = pair_index.find(Key(a, b));
+            if(itr == pair_index.end()) {
+                return;
+            }
+
+            // Swap-remove, fixing the index of the pair that moved
+            const size_t index = itr->second;
+            pair_index.erase(itr);
+            if(index + 1 != pairs.size()) {
+                pairs[index] = pairs.back();
+                pair_ids[index] = pair_ids.back();
+                pair_index[pair_ids[index]] = index;
+            }
+            pairs.pop_back();
+            pair_ids.pop_back();
+        }
+
+        // Touching counts as overlapping, so on equal values a min sorts before a max
+        static bool Before(const Endpoint& a, const Endpoint& b) {
+            return (a.value < b.value) || (a.value == b.value && !a.is_max && b.is_max);
+        }
+
+        // Sort the axis, turning every swap of a min and max endpoint into a pair change
+        void InsertionSort(std::vector<Endpoint>& axis) {
+            for(size_t i = 1; i < axis.size(); i++) {
+                const Endpoint moving = axis[i];
+                size_t j = i;
+
+                while(j > 0 && Before(moving, axis[j - 1])) {
+                    const Endpoint& passed = axis[j - 1];
+
+                    if(moving.proxy != passed.proxy) {
+                        if(!moving.is_max && passed.is_max) {
+                            // A min moved before a max, the two started overlapping on this axis
+                            if(Overlaps(moving.proxy, passed.proxy)) {
+                                AddPair(moving.proxy, passed.proxy);
+                            }
+                        } else if(moving.is_max && !passed.is_max) {
+                            // A max moved before a min, the two stopped overlapping on this axis
+                            RemovePair(moving.proxy, passed.proxy);
+                        }
+                    }
+
+                    axis[j] = passed;
+                    j--;
+                }
+
+                axis[j] = moving;
+            }
+        }
+
+        void DropRemoved() {
+            const auto dead = [this](const Endpoint& e) { return !proxies[e.proxy].alive; };
+            axis_x.erase(std::remove_if(axis_x.begin(), axis_x.end(), dead), axis_x.end());
+            axis_y.erase(std::remove_if(axis_y.begin(), axis_y.end(), dead), axis_y.end());
+
+            // Proxies removed before they were ever sorted in
+            added.erase(std::remove_if(added.begin(), added.end(), [this](uint32_t id) { return !proxies[id].alive; }), added.end());
+
+            for(size_t i = pairs.size(); i > 0; i--) {
+                const uint64_t key = pair_ids[i - 1];
+                const uint32_t a = static_cast<uint32_t>(key >> 32);
+                const uint32_t b = static_cast<uint32_t>(key);
+                if(!proxies[a].alive || !proxies[b].alive) {
+                    RemovePair(a, b);
+                }
+            }
+
+            free_ids.insert(free_ids.end(), removed.begin(), removed.end());
+            removed.clear();
+        }
+
+        std::vector<Proxy> proxies;
+        std::unordered_map<T, uint32_t> ids;
+        std::vector<uint32_t> free_ids;
+        // Proxies added or removed since the last Sort()
+        std::vector<uint32_t> added;
+        std::vector<uint32_t> removed;
+
+        std::vector<Endpoint> axis_x;
+        std::vector<Endpoint> axis_y;
+
+        // Pair cache.  pairs and pair_ids share indices, pair_index maps a key back to that index
+        std::vector<std::pair<T, T>> pairs;
+        std::vector<uint64_t> pair_ids;
+        std::unordered_map<uint64_t, size_t> pair_index;
+    };
+}
@@ -59,6 +59,35 @@ namespace utilities
         return signum(x, std::is_signed<T>());
     }
 
+    // sin for tables built at compile time, std::sin isn't constexpr before C++26.  Taylor series after
+    // reducing x to [-pi, pi], accurate to double precision
+    [[nodiscard]] constexpr double ConstexprSin(double x)
+    {
+        constexpr double pi = 3.14159265358979323846;
+        while (x > pi)
+        {
+            x -= 2.0 * pi;
+        }
+        while (x < -pi)
+        {
+            x += 2.0 * pi;
+        }
+
+        double term = x;
+        double sum = x;
+        for (int n = 1; n < 14; n++)
+        {
+            term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+            sum += term;
+        }
+        return sum;
+    }
+
+    [[nodiscard]] constexpr double ConstexprCos(double x)
+    {
+        return ConstexprSin(x + 3.14159265358979323846 / 2.0);
+    }
+
     uint16_t posToSector(olc::vf2d position);
 
     /// @brief Distance from p1 to p2 on a torus
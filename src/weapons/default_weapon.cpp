@@ -1,5 +1,7 @@
 #include "weapon.hpp"
 
+#include "systems/spatial_query.hpp"
+
 #include "utilities/random.hpp"
 #include "utilities/global_rng.hpp"
 
@@ -21,15 +23,23 @@ void Weapon::Clone(const Weapon& other) {
 
 void Weapon::on_player_input(const PlayerInput& input) {
     aim_direction = input.aim_direction;
-    shape.theta = input.aim_direction.polar().y + static_cast<float>(olc::utils::geom2d::pi) / 2.0f;
+    shape.SetTheta(input.aim_direction.polar().y + static_cast<float>(olc::utils::geom2d::pi) / 2.0f);
 }
 
 void Weapon::OnUserUpdate(float fElapsedTime) {
     accumulated_power += fElapsedTime;
 
     while(accumulated_power > prototype.fire_cost) {
+        // Auto-targeting weapons pick their own direction
+        olc::vf2d aim = aim_direction;
+        if(prototype.aim_func) {
+            if(const auto* query = reg.ctx().find<SpatialQuery>()) {
+                aim = prototype.aim_func(*query, position, aim_direction);
+            }
+        }
+
         for(int i = 0; i < prototype.projectile_count; i++) {
-            float angle = aim_direction.polar().y;
+            float angle = aim.polar().y;
             utilities::random::uniform_real_distribution<float> dist{-prototype.aim_variance, prototype.aim_variance};
             angle += dist(rng);
 
@@ -45,6 +55,7 @@ void Weapon::OnUserUpdate(float fElapsedTime) {
             spawn.on_hit_func = prototype.on_hit_func;
             spawn.on_kill_func = prototype.on_kill_func;
             spawn.color = prototype.color;
+            spawn.lightweight = prototype.lightweight;
 
             //std::cout << position << std::endl;
             dispatcher.enqueue(spawn);
@@ -69,7 +80,7 @@ void Weapon::SetPosition(olc::vf2d pos) {
 }
 
 void Weapon::Draw(olc::PixelGameEngine* pge) const {
-    shape.Draw(pge);
+    shape.Draw(pge, prototype.color);
 }
 
 ShapePrototypes Weapon::BulletShape() const {
@@ -85,7 +96,6 @@ int Weapon::Level() const {
 }
 
 Weapon::Weapon(entt::registry& reg, entt::dispatcher& dispatcher, const WeaponPrototype& prototype) : reg(reg), dispatcher(dispatcher), shape(prototypes[prototype.type]), prototype(prototype) {
-    shape.color = prototype.color;
     dispatcher.sink<PlayerInput>().connect<&Weapon::on_player_input>(this);
 }
 
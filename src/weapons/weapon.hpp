@@ -9,8 +9,7 @@
 
 #include <random>
 
-
-extern std::map<ShapePrototypes, Prototype> prototypes;
+class SpatialQuery;
 
 struct WeaponPrototype {
 	int level {1};
@@ -24,6 +23,8 @@ struct WeaponPrototype {
 	float initial_velocity {250.0f};
 	float scale {0.4f};
 	std::string name{"Standard"};
+	// Fire Projectiles instead of full Shapes, for weapons with lots of small bullets
+	bool lightweight {false};
 
 	olc::Pixel color {olc::WHITE};
 	// Function to levelup the weapon some number of times
@@ -32,6 +33,8 @@ struct WeaponPrototype {
 	std::function<void(entt::registry&, entt::dispatcher&, olc::vf2d)> on_hit_func {[](entt::registry&, entt::dispatcher&, olc::vf2d){}};
 	// Function that can be called when an enemy is killed by this weapon
 	std::function<void(entt::registry&, entt::dispatcher&, olc::vf2d)> on_kill_func {[](entt::registry&, entt::dispatcher&, olc::vf2d){}};
+	// Optional function picking the aim direction from the weapon position and the player's aim, for auto-targeting weapons
+	std::function<olc::vf2d(const SpatialQuery&, olc::vf2d position, olc::vf2d aim_direction)> aim_func;
 	ShapePrototypes type {ShapePrototypes::Triangle};
 };
 
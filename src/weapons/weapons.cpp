@@ -26,6 +26,7 @@ WeaponPrototype SpreadWeapon {
     .duration {0.7f},
     .initial_velocity {350.0f},
     .name{"Spread"},
+    .lightweight {true},
     .color {utilities::RandomGreenColor()},
     .LevelUpFunction {
         [](WeaponPrototype& weapon, int count){
@@ -48,6 +49,7 @@ WeaponPrototype Nova {
     .duration {3.0f},
     .initial_velocity {150.0f},
     .name{"Nova"},
+    .lightweight {true},
     .color {olc::DARK_YELLOW},
     .LevelUpFunction {
         [](WeaponPrototype& weapon, int count){
@@ -97,28 +99,14 @@ WeaponPrototype BurstWeapon{
     },
     .on_hit_func {
         [](entt::registry& reg, entt::dispatcher& dispatcher, olc::vf2d position) {
-            utilities::random::uniform_real_distribution<float> dist{static_cast<float>(olc::utils::geom2d::pi), -static_cast<float>(olc::utils::geom2d::pi)};
-            // Spawn a bunch of projectiles
-            for(int i = 0; i < 32; i++) {
-                float r1 = dist(rng);
-                float r2 = dist(rng);
-                float r3 = dist(rng);
+            Explosion explosion;
+            explosion.position = position;
+            explosion.radius = 96.0f;
+            explosion.damage = 24.0f;
+            explosion.particle_count = 12;
+            explosion.color = utilities::RandomRedColor();
 
-                SpawnBullet spawn;
-                spawn.position = position;
-                spawn.initial_velocity = olc::vf2d{200.0f + r1, r2}.cart();
-                spawn.angular_velocity = r3;
-                spawn.hit_count = 1;
-                spawn.damage = 3.0f;
-                spawn.duration = 3.0f;
-                spawn.angular_velocity = r1 + r2;
-                spawn.scale = 0.4f;
-                spawn.shape = ShapePrototypes::Square;
-                spawn.color = utilities::RandomRedColor();
-
-                dispatcher.enqueue(spawn);
-                dispatcher.enqueue<PlayRandomEffect>({"explode"});
-            }
+            dispatcher.enqueue(explosion);
         }
     },
     .type {ShapePrototypes::Pentagon}
@@ -131,6 +119,7 @@ WeaponPrototype RapidFireWeapon {
     .duration {5.0f},
     .scale {0.2f},
     .name {"Rapid Fire"},
+    .lightweight {true},
     .color {utilities::RandomBlueColor()},
     .LevelUpFunction {
         [](WeaponPrototype& weapon, int count){
@@ -162,28 +151,14 @@ WeaponPrototype MineLayerWeapon {
     },
     .on_hit_func {
         [](entt::registry& reg, entt::dispatcher& dispatcher, olc::vf2d position) {
-            utilities::random::uniform_real_distribution<float> dist{static_cast<float>(olc::utils::geom2d::pi), -static_cast<float>(olc::utils::geom2d::pi)};
-            // Spawn a bunch of projectiles
-            for(int i = 0; i < 32; i++) {
-                float r1 = dist(rng);
-                float r2 = dist(rng);
-                float r3 = dist(rng);
-
-                SpawnBullet spawn;
-                spawn.position = position;
-                spawn.initial_velocity = olc::vf2d{200.0f + r1, r2}.cart();
-                spawn.angular_velocity = r3;
-                spawn.hit_count = 5;
-                spawn.damage = 10.0f;
-                spawn.duration = .5f;
-                spawn.angular_velocity = r1 + r2;
-                spawn.scale = 0.4f;
-                spawn.shape = ShapePrototypes::Star6_2;
-                spawn.color = utilities::RandomRedColor();
+            Explosion explosion;
+            explosion.position = position;
+            explosion.radius = 100.0f;
+            explosion.damage = 50.0f;
+            explosion.particle_count = 16;
+            explosion.color = utilities::RandomRedColor();
 
-                dispatcher.enqueue(spawn);
-                dispatcher.enqueue<PlayRandomEffect>({"explode"});
-            }
+            dispatcher.enqueue(explosion);
         }
     },
     .type {ShapePrototypes::Cross}
@@ -0,0 +1,339 @@
+#include "world_geometry.hpp"
+#include "simd_lanes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    using simd::ScalarLanes;
+    using simd::SimdLanes;
+
+    // Squared distance from p to the segment a -> b
+    float SegmentDistance2(olc::vf2d p, olc::vf2d a, olc::vf2d b) {
+        const olc::vf2d ab = b - a;
+        const float length2 = ab.mag2();
+        const float t = (length2 > 0.0f) ? std::clamp((p - a).dot(ab) / length2, 0.0f, 1.0f) : 0.0f;
+        return (a + ab * t - p).mag2();
+    }
+
+    // True if the segments a0 -> a1 and b0 -> b1 cross
+    bool SegmentsCross(olc::vf2d a0, olc::vf2d a1, olc::vf2d b0, olc::vf2d b1) {
+        const float d0 = (a1 - a0).cross(b0 - a0);
+        const float d1 = (a1 - a0).cross(b1 - a0);
+        const float d2 = (b1 - b0).cross(a0 - b0);
+        const float d3 = (b1 - b0).cross(a1 - b0);
+        return ((d0 > 0.0f) != (d1 > 0.0f)) && ((d2 > 0.0f) != (d3 > 0.0f));
+    }
+
+    // True if p is inside the counter-clockwise convex polygon
+    bool ContainsPoint(const StridedPoints& points, size_t count, olc::vf2d p) {
+        for(size_t i = 0; i < count; i++) {
+            if((points[(i + 1) % count] - points[i]).cross(p - points[i]) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // True if some axis separates the projections of the two point sets.
+    // Set a sweep to also cover a translated by anything from zero to sweep
+    bool SeparatedOnAxes(const StridedPoints& axes, const StridedPoints& a, const StridedPoints& b, size_t a_count, size_t b_count, size_t axis_count, olc::vf2d sweep = {0.0f, 0.0f}) {
+        for(size_t i = 0; i < axis_count; i++) {
+            const olc::vf2d axis = axes[i];
+
+            float a_min = std::numeric_limits<float>::max();
+            float a_max = std::numeric_limits<float>::lowest();
+            for(size_t j = 0; j < a_count; j++) {
+                const float d = axis.dot(a[j]);
+                a_min = std::min(a_min, d);
+                a_max = std::max(a_max, d);
+            }
+
+            const float s = axis.dot(sweep);
+            a_min += std::min(0.0f, s);
+            a_max += std::max(0.0f, s);
+
+            float b_min = std::numeric_limits<float>::max();
+            float b_max = std::numeric_limits<float>::lowest();
+            for(size_t j = 0; j < b_count; j++) {
+                const float d = axis.dot(b[j]);
+                b_min = std::min(b_min, d);
+                b_max = std::max(b_max, d);
+            }
+
+            if(a_max < b_min || b_max < a_min) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Separating axis test between every pair of convex pieces.  The pieces cover exactly the
+    // triangles of the prototype so this matches a triangle by triangle test
+    bool HullsIntersect(const ShapeGeometry& self, const ShapeGeometry& other, olc::vf2d sweep) {
+        const bool swept = sweep.mag2() > 0.0f;
+        // The sides of the swept hull that run along the path
+        const olc::vf2d path_normal = swept ? sweep.perp().norm() : olc::vf2d{};
+        const StridedPoints path_axis {&path_normal.x, &path_normal.y, 0};
+
+        size_t self_offset = 0;
+        for(const auto& self_hull : self.prototype->hulls) {
+            const size_t self_count = self_hull.points.size();
+            const StridedPoints self_points = self.hull_points.From(self_offset);
+            const StridedPoints self_normals = self.hull_normals.From(self_offset);
+
+            size_t other_offset = 0;
+            for(const auto& other_hull : other.prototype->hulls) {
+                const size_t other_count = other_hull.points.size();
+                const StridedPoints other_points = other.hull_points.From(other_offset);
+                const StridedPoints other_normals = other.hull_normals.From(other_offset);
+
+                if(!SeparatedOnAxes(self_normals, self_points, other_points, self_count, other_count, self_count, sweep) &&
+                   !SeparatedOnAxes(other_normals, self_points, other_points, self_count, other_count, other_count, sweep) &&
+                   !(swept && SeparatedOnAxes(path_axis, self_points, other_points, self_count, other_count, 1, sweep))) {
+                    return true;
+                }
+
+                other_offset += other_count;
+            }
+
+            self_offset += self_count;
+        }
+
+        return false;
+    }
+
+    // Per shape transforms of one group in the SoA arrays
+    struct TransformInputs {
+        const float* px;
+        const float* py;
+        const float* scale;
+        const float* sn;
+        const float* cs;
+    };
+
+    // Transforms every local point for the shapes [first, first + width) of a group and returns first + width.
+    // Point p of shape i goes to out[p * stride + i].  rotate_only skips the scale and translation
+    template<typename L, bool rotate_only>
+    size_t TransformLanes(const TransformInputs& in, size_t first, const std::vector<olc::vf2d>& local, float* out_x, float* out_y, size_t stride) {
+        const typename L::type sn = L::load(in.sn + first);
+        const typename L::type cs = L::load(in.cs + first);
+        [[maybe_unused]] const typename L::type scale = L::load(in.scale + first);
+        [[maybe_unused]] const typename L::type px = L::load(in.px + first);
+        [[maybe_unused]] const typename L::type py = L::load(in.py + first);
+
+        for(size_t p = 0; p < local.size(); p++) {
+            const typename L::type lx = L::set1(local[p].x);
+            const typename L::type ly = L::set1(local[p].y);
+            typename L::type x = L::sub(L::mul(lx, cs), L::mul(ly, sn));
+            typename L::type y = L::add(L::mul(lx, sn), L::mul(ly, cs));
+            if constexpr(!rotate_only) {
+                x = L::add(L::mul(x, scale), px);
+                y = L::add(L::mul(y, scale), py);
+            }
+            L::store(out_x + p * stride + first, x);
+            L::store(out_y + p * stride + first, y);
+        }
+
+        return first + L::width;
+    }
+
+    template<bool rotate_only>
+    void TransformGroup(const TransformInputs& in, size_t count, const std::vector<olc::vf2d>& local, float* out_x, float* out_y) {
+        size_t i = 0;
+        while(i + SimdLanes::width <= count) {
+            i = TransformLanes<SimdLanes, rotate_only>(in, i, local, out_x, out_y, count);
+        }
+        while(i < count) {
+            i = TransformLanes<ScalarLanes, rotate_only>(in, i, local, out_x, out_y, count);
+        }
+    }
+
+    size_t HullPointCount(const Prototype& prototype) {
+        size_t count = 0;
+        for(const auto& h : prototype.hulls) {
+            count += h.points.size();
+        }
+        return count;
+    }
+}
+
+size_t ShapeGeometry::TriangleCount() const {
+    return prototype->tris.size();
+}
+
+olc::utils::geom2d::triangle<float> ShapeGeometry::Triangle(size_t i) const {
+    return {vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]};
+}
+
+void ShapeGeometry::Draw(olc::PixelGameEngine* pge, olc::Pixel color) const {
+    for(size_t i = 0; i < TriangleCount(); i++) {
+        pge->FillTriangleDecal(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], color);
+    }
+}
+
+bool ShapeGeometry::Intersects(const ShapeGeometry& other) const {
+    return HullsIntersect(*this, other, {0.0f, 0.0f});
+}
+
+bool ShapeGeometry::SweptIntersects(const ShapeGeometry& other, olc::vf2d previous) const {
+    // Swept back from the current position, the shape covers the convex hull of each piece at both ends
+    return HullsIntersect(*this, other, previous - position);
+}
+
+bool ShapeGeometry::IntersectsCapsule(olc::vf2d start, olc::vf2d end, float circle_radius) const {
+    const float radius2 = circle_radius * circle_radius;
+
+    size_t offset = 0;
+    for(const auto& hull : prototype->hulls) {
+        const size_t count = hull.points.size();
+        const StridedPoints points = hull_points.From(offset);
+        offset += count;
+
+        if(ContainsPoint(points, count, start) || ContainsPoint(points, count, end)) {
+            return true;
+        }
+
+        // Otherwise the path has to cross or come within the radius of an edge
+        for(size_t i = 0; i < count; i++) {
+            const olc::vf2d a = points[i];
+            const olc::vf2d b = points[(i + 1) % count];
+            if(SegmentsCross(start, end, a, b) ||
+               SegmentDistance2(a, start, end) <= radius2 || SegmentDistance2(b, start, end) <= radius2 ||
+               SegmentDistance2(start, a, b) <= radius2 || SegmentDistance2(end, a, b) <= radius2) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void WorldGeometry::Clear() {
+    groups = {};
+    added.clear();
+    added_shapes.clear();
+}
+
+void WorldGeometry::Add(entt::entity entity, const Shape& shape) {
+    auto& group = groups[static_cast<size_t>(shape.GetPrototype().type)];
+    group.prototype = &shape.GetPrototype();
+    group.count++;
+    added.push_back(entity);
+    added_shapes.push_back(&shape);
+}
+
+void WorldGeometry::Transform() {
+    // Lay the groups out one after another
+    uint32_t first = 0;
+    size_t point_base = 0;
+    size_t normal_base = 0;
+    for(auto& group : groups) {
+        if(group.count == 0) {
+            continue;
+        }
+
+        const size_t hull_points = HullPointCount(*group.prototype);
+        group.first = first;
+        group.point_base = point_base;
+        group.normal_base = normal_base;
+        first += group.count;
+        point_base += group.count * (group.prototype->tris.size() * 3 + hull_points);
+        normal_base += group.count * hull_points;
+    }
+
+    const size_t count = added.size();
+    entities.resize(count);
+    position_x.resize(count);
+    position_y.resize(count);
+    theta.resize(count);
+    scale.resize(count);
+    sin_theta.resize(count);
+    cos_theta.resize(count);
+    point_x.resize(point_base);
+    point_y.resize(point_base);
+    normal_x.resize(normal_base);
+    normal_y.resize(normal_base);
+    std::fill(slots.begin(), slots.end(), no_slot);
+
+    // Gather the transforms in group order, keeping the storage order inside a group
+    std::array<uint32_t, static_cast<size_t>(ShapePrototypes::Count)> cursors {};
+    for(size_t i = 0; i < groups.size(); i++) {
+        cursors[i] = groups[i].first;
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        const Shape& shape = *added_shapes[i];
+        const uint32_t slot = cursors[static_cast<size_t>(shape.GetPrototype().type)]++;
+
+        entities[slot] = added[i];
+        position_x[slot] = shape.position.x;
+        position_y[slot] = shape.position.y;
+        theta[slot] = shape.Theta();
+        scale[slot] = shape.scale;
+        sin_theta[slot] = shape.Rotation().x;
+        cos_theta[slot] = shape.Rotation().y;
+
+        const size_t index = entt::to_entity(added[i]);
+        if(index >= slots.size()) {
+            slots.resize(index + 1, no_slot);
+        }
+        slots[index] = slot;
+    }
+
+    // Every prototype point of every shape in a group.  Shapes are transformed a lane width at a time with
+    // the sin, cos, scale and position loaded once for all points of the prototype
+    for(const auto& group : groups) {
+        if(group.count == 0) {
+            continue;
+        }
+
+        const TransformInputs in {position_x.data() + group.first, position_y.data() + group.first, scale.data() + group.first,
+                                  sin_theta.data() + group.first, cos_theta.data() + group.first};
+
+        local_points.clear();
+        for(const auto& t : group.prototype->tris) {
+            local_points.insert(local_points.end(), t.pos.begin(), t.pos.end());
+        }
+        for(const auto& h : group.prototype->hulls) {
+            local_points.insert(local_points.end(), h.points.begin(), h.points.end());
+        }
+        TransformGroup<false>(in, group.count, local_points, point_x.data() + group.point_base, point_y.data() + group.point_base);
+
+        // Normals only rotate, scale and translation don't change their direction
+        local_points.clear();
+        for(const auto& h : group.prototype->hulls) {
+            local_points.insert(local_points.end(), h.normals.begin(), h.normals.end());
+        }
+        TransformGroup<true>(in, group.count, local_points, normal_x.data() + group.normal_base, normal_y.data() + group.normal_base);
+    }
+}
+
+ShapeGeometry WorldGeometry::Get(entt::entity entity, const Shape& shape) const {
+    const size_t index = entt::to_entity(entity);
+    if(index >= slots.size() || slots[index] == no_slot) {
+        return {};
+    }
+
+    const uint32_t slot = slots[index];
+    const auto& group = groups[static_cast<size_t>(shape.GetPrototype().type)];
+    if(entities[slot] != entity || group.prototype != &shape.GetPrototype() || slot < group.first || slot >= group.first + group.count ||
+       position_x[slot] != shape.position.x || position_y[slot] != shape.position.y || theta[slot] != shape.Theta() || scale[slot] != shape.scale) {
+        return {};
+    }
+
+    // Points of a shape are group.count apart
+    const size_t i = slot - group.first;
+    const size_t stride = group.count;
+    const size_t vertex_count = group.prototype->tris.size() * 3;
+
+    ShapeGeometry geometry;
+    geometry.prototype = group.prototype;
+    geometry.position = shape.position;
+    geometry.vertices = {point_x.data() + group.point_base + i, point_y.data() + group.point_base + i, stride};
+    geometry.hull_points = geometry.vertices.From(vertex_count);
+    geometry.hull_normals = {normal_x.data() + group.normal_base + i, normal_y.data() + group.normal_base + i, stride};
+    return geometry;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "components.hpp"
+#include "shape.hpp"
+
+#include "utilities/entt.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Points stored as separate x and y arrays, stride floats apart
+struct StridedPoints {
+	const float* x {nullptr};
+	const float* y {nullptr};
+	size_t stride {1};
+
+	olc::vf2d operator[](size_t i) const {
+		return {x[i * stride], y[i * stride]};
+	}
+
+	// View starting at point first
+	StridedPoints From(size_t first) const {
+		return {x + first * stride, y + first * stride, stride};
+	}
+};
+
+// World-space geometry of one shape inside the WorldGeometry buffer.  Only valid until the next Build
+struct ShapeGeometry {
+	const Prototype* prototype {nullptr};
+	olc::vf2d position {};
+	// Three vertices per triangle, in prototype order
+	StridedPoints vertices;
+	// Hull vertices and edge normals, laid out hull after hull in prototype order
+	StridedPoints hull_points;
+	StridedPoints hull_normals;
+
+	// False for shapes the buffer doesn't know or that changed since it was built
+	explicit operator bool() const {
+		return prototype != nullptr;
+	}
+
+	size_t TriangleCount() const;
+
+	olc::utils::geom2d::triangle<float> Triangle(size_t i) const;
+
+	void Draw(olc::PixelGameEngine* pge, olc::Pixel color) const;
+
+	bool Intersects(const ShapeGeometry& other) const;
+
+	// Separating axis test of this shape moving in a straight line from previous to position against other.
+	// Rotation along the way is ignored
+	bool SweptIntersects(const ShapeGeometry& other, olc::vf2d previous) const;
+
+	// True if a circle moving in a straight line from start to end touches the shape.  Pass start == end for a still circle
+	bool IntersectsCapsule(olc::vf2d start, olc::vf2d end, float circle_radius) const;
+};
+
+// World-space triangles and hulls of every Shape with a collider, stored in the registry context.
+// Shapes are grouped by prototype and each group is laid out point by point, so transforming a group is
+// one loop over contiguous arrays per prototype point, vectorised across the shapes of the group
+class WorldGeometry {
+public:
+	void Build(entt::registry& reg) {
+		Clear();
+		// Nothing else needs the geometry every tick.  Shapes without a collider are drawn from WorldTriangles
+		const auto view = reg.view<ColliderComponent, Shape>();
+		for(auto entity : view) {
+			Add(entity, view.get<Shape>(entity));
+		}
+		Transform();
+	}
+
+	// Build in steps: Clear, Add every shape, then Transform
+	void Clear();
+
+	void Add(entt::entity entity, const Shape& shape);
+
+	void Transform();
+
+	// Geometry of entity as of the last Build.  Empty if the shape was added or changed since
+	ShapeGeometry Get(entt::entity entity, const Shape& shape) const;
+
+private:
+	static constexpr uint32_t no_slot = UINT32_MAX;
+
+	struct Group {
+		const Prototype* prototype {nullptr};
+		// Range of the group in the per shape arrays
+		uint32_t first {0};
+		uint32_t count {0};
+		// Start of the group in the point and normal arrays
+		size_t point_base {0};
+		size_t normal_base {0};
+	};
+
+	std::array<Group, static_cast<size_t>(ShapePrototypes::Count)> groups {};
+
+	// Shapes in the order they were added, before grouping
+	std::vector<entt::entity> added;
+	std::vector<const Shape*> added_shapes;
+
+	// Per shape transform in group order
+	std::vector<entt::entity> entities;
+	std::vector<float> position_x, position_y, theta, scale, sin_theta, cos_theta;
+	// Index into the per shape arrays by entity index
+	std::vector<uint32_t> slots;
+
+	// Triangle vertices then hull points of every shape, and the hull normals
+	std::vector<float> point_x, point_y;
+	std::vector<float> normal_x, normal_y;
+
+	// Prototype points of the group being transformed
+	std::vector<olc::vf2d> local_points;
+};